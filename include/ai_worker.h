@@ -0,0 +1,86 @@
+/**
+ * @file ai_worker.h
+ * @brief Thread de recherche de l'IA pour l'interface GTK
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient l'interface du thread dédié à la recherche de l'IA, incluant :
+ * - La demande de recherche sur une copie de la partie
+ * - L'annulation d'une recherche en cours
+ * - La remise du coup choisi à la boucle GTK
+ * - L'arrêt du thread à la fermeture de l'application
+ *
+ * La boucle GTK ne fait jamais de recherche : elle dépose une copie de la
+ * partie et continue de redessiner et de traiter le réseau. Le thread de l'IA
+ * renvoie son coup par un unique canal, un callback g_idle_add() exécuté dans
+ * la boucle GTK, qui applique le coup seulement si la partie n'a pas changé
+ * entre-temps.
+ */
+
+#ifndef AI_WORKER_H_INCLUDED
+#define AI_WORKER_H_INCLUDED
+
+#include <gtk/gtk.h>
+
+#include "game.h"
+#include "algo.h"
+
+/**
+ * @struct AIResult
+ * @brief Coup calculé par le thread de l'IA, en attente d'application
+ */
+typedef struct {
+    Game *game;                 /**< Partie à laquelle le coup est destiné */
+    Move move;                  /**< Coup choisi par la recherche */
+    int turn;                   /**< Tour pour lequel le coup a été calculé */
+    unsigned long request_id;   /**< Identifiant de la demande ayant produit le coup */
+} AIResult;
+
+/**
+ * @brief Demande au thread de l'IA de chercher le coup du tour courant
+ *
+ * Une copie de la partie est transmise au thread, démarré au premier appel.
+ * Une demande pour le même tour que la recherche en cours est ignorée ; une
+ * demande pour un autre tour annule la recherche en cours. À appeler depuis
+ * la boucle GTK.
+ *
+ * @param game Pointeur vers la structure de jeu principale
+ * @return void
+ */
+void ai_worker_request(Game *game);
+
+/**
+ * @brief Annule la recherche en cours ou en attente
+ *
+ * La recherche s'interrompt au plus tôt et son coup ne sera pas appliqué.
+ *
+ * @return void
+ */
+void ai_worker_cancel(void);
+
+/**
+ * @brief Indique si une recherche est en cours ou en attente d'application
+ *
+ * @return int 1 si l'IA réfléchit, 0 sinon
+ */
+int ai_worker_busy(void);
+
+/**
+ * @brief Applique dans la boucle GTK le coup calculé par le thread de l'IA
+ *
+ * Callback g_idle_add() : le coup est ignoré si la demande a été annulée ou
+ * remplacée, si la partie est terminée ou si le tour a changé.
+ *
+ * @param data Pointeur vers un AIResult (libéré par la fonction)
+ * @return gboolean G_SOURCE_REMOVE pour supprimer le callback après exécution
+ */
+gboolean ai_worker_deliver(gpointer data);
+
+/**
+ * @brief Annule toute recherche et attend la fin du thread de l'IA
+ *
+ * @return void
+ */
+void ai_worker_shutdown(void);
+
+#endif // AI_WORKER_H_INCLUDED
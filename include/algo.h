@@ -5,7 +5,7 @@
  * @date 17 septembre 2025
  * 
  * Ce fichier contient les algorithmes et structures pour l'IA, incluant :
- * - Les structures de données pour les coups
+ * - Les structures de données pour les coups et leur codage sur 16 bits
  * - Les fonctions d'évaluation
  * - Les algorithmes minimax
  * - L'API pour l'IA
@@ -15,7 +15,11 @@
 #ifndef ALGO_H_INCLUDED
 #define ALGO_H_INCLUDED
 
+#include <stdatomic.h>
+#include <stdint.h>
+
 #include "game.h"
+#include "const.h"
 
 /**
  * @brief Structure représentant un coup de jeu
@@ -31,6 +35,75 @@ typedef struct {
     int score;      ///< Score associé à ce coup
 } Move;
 
+/**
+ * @brief Coup codé sur 16 bits pour les listes de coups de la recherche
+ * 
+ * Bits 0 à 6 : case de départ, bits 7 à 13 : case d'arrivée (indice
+ * ligne * GRID_SIZE + colonne), bits 14 et 15 : drapeaux MOVE_FLAG_*.
+ * Une case de départ égale à la case d'arrivée n'est jamais un coup légal :
+ * la valeur 0 (PACKED_MOVE_NONE) désigne l'absence de coup ou le coup nul.
+ */
+typedef uint16_t PackedMove;
+
+#define PACKED_MOVE_NONE ((PackedMove)0)    ///< Aucun coup (ou coup nul)
+#define PACKED_SQUARE_BITS 7                ///< Bits par case (81 cases)
+#define PACKED_SQUARE_MASK 0x7F             ///< Masque d'une case
+#define PACKED_SQUARES_MASK 0x3FFF          ///< Masque des cases de départ et d'arrivée
+#define MOVE_FLAG_CAPTURE 0x4000            ///< Coup qui capture au moins une pièce
+
+/**
+ * @brief Code un coup à partir de ses cases de départ et d'arrivée
+ * 
+ * @param from Case de départ (ligne * GRID_SIZE + colonne)
+ * @param to Case d'arrivée
+ * @return PackedMove Coup codé, sans drapeau
+ */
+static inline PackedMove packed_move(int from, int to) {
+    return (PackedMove)(from | (to << PACKED_SQUARE_BITS));
+}
+
+/** @brief Case de départ d'un coup codé */
+static inline int packed_from(PackedMove move) {
+    return move & PACKED_SQUARE_MASK;
+}
+
+/** @brief Case d'arrivée d'un coup codé */
+static inline int packed_to(PackedMove move) {
+    return (move >> PACKED_SQUARE_BITS) & PACKED_SQUARE_MASK;
+}
+
+/** @brief Indique si deux coups codés ont mêmes cases de départ et d'arrivée, drapeaux ignorés */
+static inline int packed_same(PackedMove a, PackedMove b) {
+    return ((a ^ b) & PACKED_SQUARES_MASK) == 0;
+}
+
+/**
+ * @brief Code un coup de l'API publique
+ * 
+ * @param move Coup à coder (coordonnées valides)
+ * @return PackedMove Coup codé, sans drapeau
+ */
+static inline PackedMove move_pack(Move move) {
+    return packed_move(move.src_row * GRID_SIZE + move.src_col, move.dst_row * GRID_SIZE + move.dst_col);
+}
+
+/**
+ * @brief Décode un coup pour l'API publique
+ * 
+ * @param move Coup codé, PACKED_MOVE_NONE donnant des coordonnées à -1
+ * @return Move Coup décodé, de score -1 comme ceux des générateurs
+ */
+static inline Move move_unpack(PackedMove move) {
+    if (move == PACKED_MOVE_NONE) {
+        Move none = {-1, -1, -1, -1, -1};
+        return none;
+    }
+    int from = packed_from(move);
+    int to = packed_to(move);
+    Move unpacked = {from / GRID_SIZE, from % GRID_SIZE, to / GRID_SIZE, to % GRID_SIZE, -1};
+    return unpacked;
+}
+
 /**
  * @brief Structure représentant une pièce capturée
  * 
@@ -43,14 +116,19 @@ typedef struct {
 } EatenPiece;
 
 /**
- * @brief Structure combinant un coup avec son score d'évaluation
+ * @brief Compteurs relevés pendant une recherche
  * 
- * Utilisée pour l'ordonnancement et l'évaluation des coups dans les algorithmes d'IA.
+ * Le taux de coupure (cutoffs / expanded) et la part des coupures obtenues
+ * dès le premier coup mesurent la qualité du tri des coups.
  */
 typedef struct {
-    Move s_move;    ///< Le coup de jeu
-    int score;      ///< Score d'évaluation pour ce coup
-} ScoredMove;
+    int score;                      ///< Score du coup retenu, pour le joueur au trait
+    unsigned long nodes;            ///< Nœuds visités, quiescence comprise
+    unsigned long qnodes;           ///< Nœuds de quiescence
+    unsigned long expanded;         ///< Nœuds dont les coups ont été explorés
+    unsigned long cutoffs;          ///< Coupures alpha-bêta
+    unsigned long first_cutoffs;    ///< Coupures obtenues dès le premier coup
+} SearchStats;
 
 typedef struct {
     int WIN;
@@ -68,13 +146,30 @@ typedef struct {
 } UtilWeights;
 
 // Fonctions essentielles qui décrivent l'état du jeu
-int utility(Game * game, Player player);
-int all_possible_moves(Game * game, Move * move_list, Player player);
+int utility(const Game * game, Player player);
+int all_possible_moves(const Game * game, Move * move_list, Player player);
 int all_possible_moves_ordered(Game *game, Move * move_list, Player player);
+void update_with_move(Game * game, Move move);
+
+// Notation réseau des coups ("A1B2" : colonne A-I et ligne 1-9 de départ puis d'arrivée)
+void move_to_notation(Move move, char notation[5]);
+int move_from_notation(const char * notation, Move * move);
 
 // Fonctions de calcul IA
 int minimax_alpha_beta(Game * game, int depth, int maximizing, int alpha, int beta, Player initial_player);
 Move minimax_best_move(Game * game, int depth);
+Move minimax_best_move_stats(Game * game, int depth, SearchStats * stats);
+Move minimax_best_move_parallel(Game * game, int depth, SearchStats * stats);
+Move minimax_best_move_timed(Game * game, int time_budget_ms);
+Move minimax_best_move_cancellable(Game * game, int time_budget_ms, atomic_int * cancel);
+int ai_time_budget_ms(const Game * game);
+void ai_set_threads(int threads);
+int ai_get_threads(void);
+void ai_reset_heuristics(void);
+
+// Comptage des feuilles (perft) : contrôle et chronométrage du générateur de coups
+unsigned long long perft(Game * game, int depth);
+unsigned long long perft_reference(Game * game, int depth);
 
 // API pour game.c et main.c
 void client_first_move(Game * game);
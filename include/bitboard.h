@@ -0,0 +1,261 @@
+/**
+ * @file bitboard.h
+ * @brief Représentation bitboard du plateau pour la recherche de l'IA
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient la représentation du plateau 9x9 sous forme de bitboards, incluant :
+ * - Le type Bitboard (81 cases réparties sur deux mots de 64 bits)
+ * - Les tables de rayons, de voisinage et de poids par case générées à la compilation
+ * - La position bitboard (occupation par camp, rois, cases visitées)
+ * - Les opérations élémentaires sur les bitboards
+ * - Le générateur de coups glissants basé sur des masques de rayons
+ * - Le générateur de captures utilisé par la recherche de quiescence
+ *
+ * Les générateurs sont spécialisés par camp (SIDE_SPECIALIZED) : le joueur
+ * n'est testé qu'une fois, à l'entrée des fonctions publiques.
+ *
+ * La case (ligne, colonne) correspond au bit ligne * GRID_SIZE + colonne. Les cases 0 à 63
+ * sont stockées dans le mot bas, les cases 64 à 80 dans les bits 0 à 16 du mot haut.
+ */
+
+#ifndef BITBOARD_H_INCLUDED
+#define BITBOARD_H_INCLUDED
+
+#include <stdint.h>
+
+#include "game.h"
+#include "algo.h"
+#include "const.h"
+
+/** @brief Nombre de cases du plateau */
+#define BB_SQUARES 81
+
+/** @brief Indice de case à partir des coordonnées (ligne, colonne) */
+#define BB_SQUARE(row, col) ((row) * GRID_SIZE + (col))
+
+/**
+ * @brief Fonction spécialisée par camp, toujours développée à l'appel
+ *
+ * Une telle fonction reçoit le camp (0 = P1, 1 = P2) en paramètre et n'est
+ * appelée qu'avec une constante : chaque appel produit une copie où le camp
+ * est connu à la compilation, sans test du joueur dans les boucles.
+ */
+#define SIDE_SPECIALIZED static inline __attribute__((always_inline))
+
+/**
+ * @struct Bitboard
+ * @brief Ensemble de cases du plateau codé sur 128 bits
+ */
+typedef struct {
+    uint64_t lo;    /**< Cases 0 à 63 */
+    uint64_t hi;    /**< Cases 64 à 80 (bits 0 à 16) */
+} Bitboard;
+
+/**
+ * @struct BitboardPosition
+ * @brief Position complète sous forme de plans de bits
+ *
+ * Chaque case du plateau apparaît dans au plus un plan d'occupation ou de
+ * visite, exactement comme une case de Game.board contient une seule Piece.
+ */
+typedef struct {
+    Bitboard pieces[2];     /**< Occupation par camp (indice 0 = P1, 1 = P2) */
+    Bitboard kings;         /**< Rois des deux camps */
+    Bitboard visited[2];    /**< Cases visitées par camp (indice 0 = P1, 1 = P2) */
+} BitboardPosition;
+
+/*
+ * Tables précalculées à la compilation par tools/gen_tables.c : BB_RAYS,
+ * BB_NEIGHBOUR, BB_ADJACENT, BB_SURROUNDING, EVAL_CENTER et EVAL_FORWARD.
+ * Elles sont static const : connues du compilateur dans chaque module, sans
+ * initialisation au démarrage.
+ */
+#include "bitboard_tables.h"
+
+// ============================================================================
+// OPÉRATIONS ÉLÉMENTAIRES
+// ============================================================================
+
+/** @brief Bitboard ne contenant que la case donnée */
+static inline Bitboard bb_square(int square) {
+    Bitboard b = {0, 0};
+    if (square < 64) b.lo = 1ULL << square;
+    else b.hi = 1ULL << (square - 64);
+    return b;
+}
+
+/** @brief Teste la présence d'une case dans un bitboard */
+static inline int bb_test(Bitboard b, int square) {
+    return (square < 64) ? (int)((b.lo >> square) & 1) : (int)((b.hi >> (square - 64)) & 1);
+}
+
+/** @brief Ajoute une case à un bitboard */
+static inline void bb_set(Bitboard *b, int square) {
+    if (square < 64) b->lo |= 1ULL << square;
+    else b->hi |= 1ULL << (square - 64);
+}
+
+/** @brief Retire une case d'un bitboard */
+static inline void bb_clear(Bitboard *b, int square) {
+    if (square < 64) b->lo &= ~(1ULL << square);
+    else b->hi &= ~(1ULL << (square - 64));
+}
+
+/** @brief Union de deux bitboards */
+static inline Bitboard bb_or(Bitboard a, Bitboard b) {
+    Bitboard r = {a.lo | b.lo, a.hi | b.hi};
+    return r;
+}
+
+/** @brief Intersection de deux bitboards */
+static inline Bitboard bb_and(Bitboard a, Bitboard b) {
+    Bitboard r = {a.lo & b.lo, a.hi & b.hi};
+    return r;
+}
+
+/** @brief Cases de a absentes de b */
+static inline Bitboard bb_andnot(Bitboard a, Bitboard b) {
+    Bitboard r = {a.lo & ~b.lo, a.hi & ~b.hi};
+    return r;
+}
+
+/** @brief Vérifie si un bitboard est vide */
+static inline int bb_is_empty(Bitboard b) {
+    return (b.lo | b.hi) == 0;
+}
+
+/** @brief Nombre de cases présentes dans un bitboard */
+static inline int bb_popcount(Bitboard b) {
+    return __builtin_popcountll(b.lo) + __builtin_popcountll(b.hi);
+}
+
+/** @brief Plus petite case d'un bitboard non vide */
+static inline int bb_lsb(Bitboard b) {
+    return b.lo ? __builtin_ctzll(b.lo) : 64 + __builtin_ctzll(b.hi);
+}
+
+/** @brief Plus grande case d'un bitboard non vide */
+static inline int bb_msb(Bitboard b) {
+    return b.hi ? 127 - __builtin_clzll(b.hi) : 63 - __builtin_clzll(b.lo);
+}
+
+/** @brief Extrait et retire la plus petite case d'un bitboard non vide */
+static inline int bb_pop_lsb(Bitboard *b) {
+    int square = bb_lsb(*b);
+    if (b->lo) b->lo &= b->lo - 1;
+    else b->hi &= b->hi - 1;
+    return square;
+}
+
+/** @brief Extrait et retire la plus grande case d'un bitboard non vide */
+static inline int bb_pop_msb(Bitboard *b) {
+    int square = bb_msb(*b);
+    bb_clear(b, square);
+    return square;
+}
+
+/** @brief Cases occupées par une pièce, tous camps confondus */
+static inline Bitboard bb_occupied(const BitboardPosition *pos) {
+    return bb_or(pos->pieces[0], pos->pieces[1]);
+}
+
+/**
+ * @brief Contenu d'une case, lu dans les plans de bits
+ *
+ * @param pos Position bitboard
+ * @param square Indice de la case (0-80)
+ * @return Piece Contenu de la case, comme dans Game.board
+ */
+static inline Piece bitboard_piece_at(const BitboardPosition *pos, int square) {
+    Piece king = bb_test(pos->kings, square) ? PIECE_KING_FLAG : 0;
+    if (bb_test(pos->pieces[0], square)) return P1_PAWN | king;
+    if (bb_test(pos->pieces[1], square)) return P2_PAWN | king;
+    if (bb_test(pos->visited[0], square)) return P1_VISITED;
+    if (bb_test(pos->visited[1], square)) return P2_VISITED;
+    return P_NONE;
+}
+
+// ============================================================================
+// POSITION ET GÉNÉRATION DE COUPS
+// ============================================================================
+
+/**
+ * @brief Construit la position bitboard correspondant au plateau d'une partie
+ *
+ * @param pos Position bitboard à remplir
+ * @param game Partie dont le plateau est converti
+ * @return void
+ */
+void bitboard_from_game(BitboardPosition *pos, const Game *game);
+
+/**
+ * @brief Met à jour une case de la position avec le contenu donné
+ *
+ * Retire la case de tous les plans puis l'ajoute aux plans correspondant à
+ * la pièce. À appeler pour chaque écriture dans Game.board pendant la recherche.
+ *
+ * @param pos Position bitboard à modifier
+ * @param square Indice de la case (0-80)
+ * @param piece Nouveau contenu de la case
+ * @return void
+ */
+void bitboard_put(BitboardPosition *pos, int square, Piece piece);
+
+/**
+ * @brief Calcule les destinations d'une pièce glissante
+ *
+ * Une pièce se déplace en ligne droite jusqu'à la première pièce rencontrée ;
+ * les cases visitées ne bloquent pas le passage.
+ *
+ * @param pos Position bitboard
+ * @param square Case de la pièce
+ * @return Bitboard Ensemble des cases d'arrivée possibles
+ */
+Bitboard bitboard_piece_moves(const BitboardPosition *pos, int square);
+
+/**
+ * @brief Génère tous les coups d'un joueur à partir des bitboards
+ *
+ * Les coups sont produits dans le même ordre que all_possible_moves() :
+ * pièces par case croissante, puis directions bas, haut, droite, gauche,
+ * par distance croissante. Les coups sont codés sur 16 bits (PackedMove),
+ * sans drapeau.
+ *
+ * @param pos Position bitboard
+ * @param player Joueur dont on génère les coups (P1 ou P2)
+ * @param list Tableau de sortie (au moins 10*16 éléments)
+ * @return int Nombre de coups générés
+ */
+int bitboard_generate_moves(const BitboardPosition *pos, Player player, PackedMove *list);
+
+/**
+ * @brief Génère uniquement les coups qui capturent, et éventuellement ceux qui menacent le roi
+ *
+ * Un coup capture s'il arrive à côté d'une pièce adverse déjà flanquée d'un
+ * allié de l'autre côté (sandwich), ou s'il s'arrête contre une pièce adverse
+ * non protégée derrière elle dans le sens du déplacement (sprint). Les cases
+ * de sandwich sont calculées une fois à partir des pièces adverses : aucun
+ * coup n'est joué pour savoir s'il capture.
+ *
+ * Les coups sont produits pièce par pièce, dans le même ordre de directions
+ * que bitboard_generate_moves().
+ *
+ * @param pos Position bitboard
+ * @param player Joueur dont on génère les coups (P1 ou P2)
+ * @param list Tableau de sortie (au moins 10*16 éléments)
+ * @param king_threats 1 pour ajouter les coups arrivant au contact du roi adverse
+ * @return int Nombre de coups générés
+ */
+int bitboard_generate_captures(const BitboardPosition *pos, Player player, PackedMove *list, int king_threats);
+
+/**
+ * @brief Compte les coups d'un joueur sans les générer
+ *
+ * @param pos Position bitboard
+ * @param player Joueur dont on compte les coups (P1 ou P2)
+ * @return int Nombre de coups légaux
+ */
+int bitboard_count_moves(const BitboardPosition *pos, Player player);
+
+#endif // BITBOARD_H_INCLUDED
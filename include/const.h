@@ -28,6 +28,12 @@
 #define DEPTH 4
 #define DEPTH_ENDGAME 3  // Profondeur plus élevée en fin de partie
 #define ENDGAME_PIECE_THRESHOLD 3  // Seuil pour considérer comme fin de partie
+#define TT_SIZE_MB 16  // Taille de la table de transposition en Mo
+#define AI_TIME_BUDGET_MS 2000  // Temps de réflexion de l'IA par coup
+#define MAX_SEARCH_DEPTH 32  // Profondeur maximale de l'approfondissement itératif
+#define AI_THREADS 0  // Threads de recherche de l'IA (0 = nombre de cœurs disponibles)
+#define AI_MAX_THREADS 64  // Nombre maximal de threads de recherche
+#define QUIESCENCE_MAX_DEPTH 6  // Plis de captures explorés au-delà de la profondeur nominale
 
 // Constantes de logging
 #define MAX_FILENAME_LEN 256
@@ -38,17 +44,23 @@
 #define BUFFER_SIZE 1024
 #define DEFAULT_PORT 5555
 
+// Contenus de case valides, dans l'ordre de leur chiffre au format texte (position.h)
+#define PIECE_KIND_COUNT 7
+static const Piece PIECE_KINDS[PIECE_KIND_COUNT] = {
+    P_NONE, P1_PAWN, P2_PAWN, P1_KING, P2_KING, P1_VISITED, P2_VISITED
+};
+
 // Plateau de départ standard pour le jeu
 static const Piece STARTING_BOARD[GRID_SIZE][GRID_SIZE] = {
-    {0, 0, 1, 1, 0, 0, 0, 0, 0},
-    {0, 3, 1, 1, 0, 0, 0, 0, 0},
-    {1, 1, 1, 0, 0, 0, 0, 0, 0},
-    {1, 1, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 2, 2},
-    {0, 0, 0, 0, 0, 0, 2, 2, 2},
-    {0, 0, 0, 0, 0, 2, 2, 4, 0},
-    {0, 0, 0, 0, 0, 2, 2, 0, 0},
+    {P_NONE,  P_NONE,  P1_PAWN, P1_PAWN, P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE},
+    {P_NONE,  P1_KING, P1_PAWN, P1_PAWN, P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE},
+    {P1_PAWN, P1_PAWN, P1_PAWN, P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE},
+    {P1_PAWN, P1_PAWN, P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE},
+    {P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE},
+    {P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P2_PAWN, P2_PAWN},
+    {P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P2_PAWN, P2_PAWN, P2_PAWN},
+    {P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P2_PAWN, P2_PAWN, P2_KING, P_NONE},
+    {P_NONE,  P_NONE,  P_NONE,  P_NONE,  P_NONE,  P2_PAWN, P2_PAWN, P_NONE,  P_NONE},
 };
 
 #endif //IMMERSION_CONST_H
@@ -14,6 +14,7 @@
 
 #ifndef GAME_H_INCLUDED
 #define GAME_H_INCLUDED
+#include <stdint.h>
 #include <time.h>
 
 /**
@@ -42,21 +43,75 @@ typedef enum {
 } Player;
 
 /**
- * @enum Piece
+ * @brief Champs de bits d'une case du plateau
+ * 
+ * Une case tient sur un octet :
+ * - bits 0-1 : joueur dont la pièce occupe la case (valeur de Player, 0 si aucune)
+ * - bit 2 : la pièce est un roi
+ * - bit 3 : case visitée (libérée par une pièce)
+ * - bit 4 : la case a été libérée par le joueur 2 (cases visitées)
+ * 
+ * Le propriétaire d'une case s'obtient ainsi par un simple masque.
+ */
+#define PIECE_OWNER_MASK 0x03
+#define PIECE_KING_FLAG 0x04
+#define PIECE_VISITED_FLAG 0x08
+#define PIECE_VISITOR_P2_FLAG 0x10
+
+/**
+ * @brief Contenu d'une case du plateau (un octet, voir PIECE_OWNER_MASK)
+ */
+typedef uint8_t Piece;
+
+/**
+ * @enum PieceKind
  * @brief Types de pièces et états des cases du plateau
  * 
  * Définit tous les types de pièces possibles sur le plateau ainsi que
  * les états spéciaux des cases (vides, visitées).
  */
-typedef enum {
-    P_NONE = 0,   /**< Case vide */
-    P1_PAWN,      /**< Pion du joueur 1 */
-    P2_PAWN,      /**< Pion du joueur 2 */
-    P1_KING,      /**< Roi du joueur 1 */
-    P2_KING,      /**< Roi du joueur 2 */
-    P1_VISITED,   /**< Case précédemment occupée par le joueur 1 */
-    P2_VISITED    /**< Case précédemment occupée par le joueur 2 */
-} Piece;
+enum PieceKind {
+    P_NONE = 0,                                         /**< Case vide */
+    P1_PAWN = P1,                                       /**< Pion du joueur 1 */
+    P2_PAWN = P2,                                       /**< Pion du joueur 2 */
+    P1_KING = P1 | PIECE_KING_FLAG,                     /**< Roi du joueur 1 */
+    P2_KING = P2 | PIECE_KING_FLAG,                     /**< Roi du joueur 2 */
+    P1_VISITED = PIECE_VISITED_FLAG,                    /**< Case précédemment occupée par le joueur 1 */
+    P2_VISITED = PIECE_VISITED_FLAG | PIECE_VISITOR_P2_FLAG  /**< Case précédemment occupée par le joueur 2 */
+};
+
+/** @brief Nombre de valeurs possibles d'une case (tables indexées par Piece) */
+#define PIECE_VALUES (P2_VISITED + 1)
+
+/**
+ * @brief Joueur dont la pièce occupe une case
+ * 
+ * @param piece Contenu de la case
+ * @return Player P1, P2 ou NOT_PLAYER (case vide ou visitée)
+ */
+static inline Player piece_owner(Piece piece) {
+    return (Player)(piece & PIECE_OWNER_MASK);
+}
+
+/**
+ * @brief Indique si une case contient un roi
+ * 
+ * @param piece Contenu de la case
+ * @return int Non nul pour P1_KING et P2_KING
+ */
+static inline int piece_is_king(Piece piece) {
+    return piece & PIECE_KING_FLAG;
+}
+
+/**
+ * @brief Case visitée laissée par la pièce d'un joueur
+ * 
+ * @param player Joueur dont la pièce quitte la case (P1 ou P2)
+ * @return Piece P1_VISITED ou P2_VISITED
+ */
+static inline Piece piece_visited_by(Player player) {
+    return (player == P2) ? P2_VISITED : P1_VISITED;
+}
 
 /**
  * @enum Direction
@@ -89,7 +144,7 @@ typedef struct {
     time_t turn_timer;      /**< Timestamp du début du tour actuel */
     
     GameMode game_mode;     /**< Mode de jeu actuel (LOCAL, SERVER, CLIENT) */
-    Piece board[9][9];      /**< Plateau de jeu 9x9 contenant les pièces */
+    Piece board[9][9];      /**< Plateau de jeu 9x9 contenant les pièces (un octet par case) */
 } Game;
 
 // ============================================================================
@@ -108,6 +163,17 @@ typedef struct {
  */
 void won(Game* game);
 
+/**
+ * @brief Détermine le vainqueur sans modifier la partie
+ * 
+ * Applique les mêmes règles que won() et retourne le résultat qu'elle
+ * enregistrerait, sans écrire dans la structure ni la copier.
+ * 
+ * @param game Pointeur vers la structure de jeu à examiner
+ * @return Player P1, P2, DRAW, ou NOT_PLAYER si la partie continue
+ */
+Player compute_winner(const Game* game);
+
 /**
  * @brief Gère les captures de pièces après un mouvement
  * 
@@ -137,7 +203,7 @@ void did_eat(Game* game, int row, int col, Direction sprint_direction);
  * @param dst_col Colonne de la case destination
  * @return int 1 si le mouvement est légal, 0 sinon
  */
-int is_move_legal(Game* game, int src_row, int src_col, int dst_row, int dst_col);
+int is_move_legal(const Game* game, int src_row, int src_col, int dst_row, int dst_col);
 
 /**
  * @brief Détermine le joueur propriétaire d'une pièce
@@ -155,13 +221,25 @@ Player get_player(Piece piece);
 // FONCTIONS DE STATISTIQUES ET SCORES
 // ============================================================================
 
+/**
+ * @brief Calcule le score actuel d'un joueur
+ * 
+ * Compte les cases visitées par le joueur et ses pièces encore en vie,
+ * directement sur le plateau pointé.
+ * 
+ * @param game Pointeur vers la structure de jeu à analyser
+ * @param player Joueur dont le score est calculé (P1 ou P2)
+ * @return int Score du joueur
+ */
+int player_score(const Game* game, Player player);
+
 /**
  * @brief Calcule le score actuel du joueur 1
  * 
  * Cette fonction compte et évalue les pièces du joueur 1 présentes sur le plateau
  * pour calculer son score selon les règles de comptage établies.
  * 
- * @param game Structure de jeu à analyser (passée par valeur)
+ * @param game Structure de jeu à analyser (passée par valeur, préférer player_score())
  * @return int Score du joueur 1
  */
 int score_player_one(Game game);
@@ -172,7 +250,7 @@ int score_player_one(Game game);
  * Cette fonction compte et évalue les pièces du joueur 2 présentes sur le plateau
  * pour calculer son score selon les règles de comptage établies.
  * 
- * @param game Structure de jeu à analyser (passée par valeur)
+ * @param game Structure de jeu à analyser (passée par valeur, préférer player_score())
  * @return int Score du joueur 2
  */
 int score_player_two(Game game);
@@ -217,7 +295,7 @@ Game init_game(GameMode mode, int artificial_intelligence);
  * @param game Pointeur vers la structure de jeu
  * @return Player Joueur dont c'est le tour (P1 ou P2)
  */
-Player current_player_turn(Game* game);
+Player current_player_turn(const Game* game);
 
 
 #endif // GAME_H_INCLUDED
@@ -19,6 +19,7 @@
 
 #include <gtk/gtk.h>
 #include "game.h"
+#include "algo.h"
 
 // ============================================================================
 // GESTION DES MOUVEMENTS UTILISATEUR
@@ -72,6 +73,18 @@ void detect_click(GtkWidget *drawing_area, Game *game);
  */
 void ai_network_move(Game *game);
 
+/**
+ * @brief Transmet et applique un mouvement déjà calculé par l'IA en mode réseau
+ * 
+ * Convertit le mouvement au format réseau, l'envoie au joueur distant puis
+ * l'applique localement. Doit être appelée depuis la boucle GTK.
+ * 
+ * @param game Pointeur vers la structure de jeu en mode réseau
+ * @param best_move Mouvement choisi par l'IA
+ * @return void
+ */
+void ai_network_play(Game *game, Move best_move);
+
 /**
  * @brief Vérifie si l'IA doit effectuer le premier mouvement
  * 
@@ -0,0 +1,117 @@
+/**
+ * @file mailbox.h
+ * @brief Plateau mailbox bordé de sentinelles pour les règles de capture
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient une copie 11x11 du plateau 9x9 entourée d'un anneau de
+ * cases hors plateau, incluant :
+ * - Le type Mailbox et la conversion des coordonnées
+ * - Les décalages des directions et des voisins
+ * - La règle de capture du jeu (sprint et sandwich) sans test de bornes
+ *
+ * La case (ligne, colonne) correspond à l'indice (ligne + 1) * MB_SIZE + colonne + 1.
+ * Les cases de l'anneau contiennent MB_OFFBOARD, dont le propriétaire est
+ * NOT_PLAYER : un voisin ou une case située deux pas plus loin se lit
+ * directement, sans vérifier qu'il est sur le plateau. Un anneau d'une case
+ * suffit, la case deux pas plus loin n'étant lue que si le voisin est sur
+ * le plateau.
+ */
+
+#ifndef MAILBOX_H_INCLUDED
+#define MAILBOX_H_INCLUDED
+
+#include "game.h"
+#include "const.h"
+
+/** @brief Largeur du plateau bordé (plateau et anneau de sentinelles) */
+#define MB_SIZE (GRID_SIZE + 2)
+
+/** @brief Nombre de cases du plateau bordé */
+#define MB_SQUARES (MB_SIZE * MB_SIZE)
+
+/** @brief Indice de case à partir des coordonnées (ligne, colonne) du plateau */
+#define MB_SQUARE(row, col) (((row) + 1) * MB_SIZE + (col) + 1)
+
+/** @brief Ligne du plateau d'un indice de case */
+#define MB_ROW(square) ((square) / MB_SIZE - 1)
+
+/** @brief Colonne du plateau d'un indice de case */
+#define MB_COL(square) ((square) % MB_SIZE - 1)
+
+/** @brief Contenu des cases hors plateau : aucun bit de propriétaire */
+#define MB_OFFBOARD ((Piece)0x20)
+
+/**
+ * @struct Mailbox
+ * @brief Plateau bordé d'un anneau de cases hors plateau
+ */
+typedef struct {
+    Piece cells[MB_SQUARES];    /**< Contenu des cases, MB_OFFBOARD sur l'anneau */
+} Mailbox;
+
+/** @brief Décalage d'indice d'un pas dans chaque direction, indexé par Direction */
+extern const int MB_DIRECTION[4];
+
+/** @brief Décalages des huit cases voisines, diagonales comprises */
+extern const int MB_SURROUNDING[8];
+
+/**
+ * @brief Construit le plateau bordé d'une partie
+ *
+ * @param mb Plateau bordé à remplir
+ * @param game Partie à convertir
+ * @return void
+ */
+void mailbox_from_game(Mailbox *mb, const Game *game);
+
+/**
+ * @brief Cherche les pièces capturées par une pièce arrivant sur une case
+ *
+ * Applique la règle de did_eat() : un adversaire voisin est capturé s'il est
+ * pris en sandwich contre une pièce de player, ou si la pièce arrive dans sa
+ * direction (sprint) et qu'aucun allié ne le couvre derrière lui. Le plateau
+ * n'est pas modifié.
+ *
+ * @param mb Plateau bordé, pièce déjà posée sur square
+ * @param square Case d'arrivée (indice MB_SQUARE)
+ * @param sprint_direction Direction du déplacement
+ * @param player Joueur qui vient de jouer
+ * @param captured Cases capturées (au plus 4), dans l'ordre de Direction
+ * @return int Nombre de pièces capturées
+ */
+int mailbox_captures(const Mailbox *mb, int square, Direction sprint_direction, Player player, int captured[4]);
+
+/**
+ * @brief Compte les voisins orthogonaux appartenant à un joueur
+ *
+ * @param mb Plateau bordé
+ * @param square Case examinée (indice MB_SQUARE)
+ * @param owner Joueur recherché
+ * @return int Nombre de voisins (0 à 4)
+ */
+static inline int mailbox_adjacent(const Mailbox *mb, int square, Player owner) {
+    int count = 0;
+    for (int d = 0; d < 4; d++) {
+        count += piece_owner(mb->cells[square + MB_DIRECTION[d]]) == owner;
+    }
+    return count;
+}
+
+/**
+ * @brief Compte les voisins appartenant à un joueur, diagonales comprises
+ *
+ * @param mb Plateau bordé
+ * @param square Case examinée (indice MB_SQUARE)
+ * @param owner Joueur recherché
+ * @return int Nombre de voisins (0 à 8)
+ */
+static inline int mailbox_surrounding(const Mailbox *mb, int square, Player owner) {
+    int count = 0;
+    for (int d = 0; d < 8; d++) {
+        count += piece_owner(mb->cells[square + MB_SURROUNDING[d]]) == owner;
+    }
+    return count;
+}
+
+#endif // MAILBOX_H_INCLUDED
@@ -0,0 +1,80 @@
+/**
+ * @file position.h
+ * @brief Lecture et écriture de positions sous forme de texte
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient l'interface de conversion entre une partie et sa
+ * description textuelle, incluant :
+ * - La lecture d'une position depuis une chaîne
+ * - L'écriture d'une position dans une chaîne
+ * - Le chargement d'un fichier de positions (outils perft et bench)
+ *
+ * Une position s'écrit sous la forme "<plateau> <tour>" : le plateau est
+ * composé des 9 lignes séparées par '/', chaque case étant le chiffre de sa
+ * Piece (0 vide, 1 et 2 pions, 3 et 4 rois, 5 et 6 cases visitées), soit son
+ * indice dans PIECE_KINDS (const.h), indépendant de l'encodage en octet. Le tour fixe le joueur au trait (pair = P1).
+ * La position de départ s'écrit ainsi :
+ *
+ *   001100000/031100000/111000000/110000000/000000000/000000022/000000222/000002240/000002200 0
+ */
+
+#ifndef POSITION_H_INCLUDED
+#define POSITION_H_INCLUDED
+
+#include <stddef.h>
+
+#include "game.h"
+
+/** @brief Taille minimale d'un tampon recevant une position écrite */
+#define POSITION_MAX_LEN 96
+
+/** @brief Taille maximale du libellé d'une position d'un fichier */
+#define POSITION_LABEL_LEN 64
+
+/**
+ * @struct PositionEntry
+ * @brief Position lue dans un fichier, avec son libellé
+ */
+typedef struct {
+    Game game;                          /**< Partie correspondant à la position */
+    char label[POSITION_LABEL_LEN];     /**< Texte suivant la position sur la ligne */
+} PositionEntry;
+
+/**
+ * @brief Construit une partie à partir d'une position texte
+ *
+ * La partie est initialisée comme par init_game(LOCAL, 0) puis reçoit le
+ * plateau et le tour lus. Le tour est facultatif (0 par défaut).
+ *
+ * @param game Partie à remplir
+ * @param text Position à lire
+ * @return int Nombre de caractères lus, -1 si la position est invalide
+ */
+int position_parse(Game *game, const char *text);
+
+/**
+ * @brief Écrit la position d'une partie
+ *
+ * @param game Partie à décrire
+ * @param buffer Tampon de sortie (au moins POSITION_MAX_LEN octets)
+ * @param size Taille du tampon
+ * @return void
+ */
+void position_format(const Game *game, char *buffer, size_t size);
+
+/**
+ * @brief Charge les positions d'un fichier texte
+ *
+ * Une position par ligne, éventuellement suivie d'un libellé. Les lignes
+ * vides et celles commençant par '#' sont ignorées ; une ligne invalide est
+ * signalée dans les logs puis ignorée.
+ *
+ * @param path Chemin du fichier
+ * @param entries Tableau de sortie
+ * @param max Nombre maximal de positions à lire
+ * @return int Nombre de positions lues, -1 si le fichier ne peut être ouvert
+ */
+int position_load_file(const char *path, PositionEntry *entries, int max);
+
+#endif // POSITION_H_INCLUDED
@@ -0,0 +1,124 @@
+/**
+ * @file transposition.h
+ * @brief Table de transposition de la recherche de l'IA
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient les déclarations de la table de transposition, incluant :
+ * - Le type de borne associé à un score (exact, borne inférieure, borne supérieure)
+ * - La structure d'une entrée de table
+ * - L'allocation de la table avec une taille configurable en Mo
+ * - La consultation et l'enregistrement des résultats de recherche
+ *
+ * La table est unique pour tout le programme, de taille fixe, et indexée par
+ * les bits de poids faible de la clé Zobrist. En cas de collision d'indice,
+ * l'entrée la plus profonde est conservée, sauf si elle date d'une recherche précédente.
+ *
+ * La table est partagée sans verrou entre les threads de recherche : chaque
+ * case stocke les données de l'entrée sur 64 bits et la clé combinée par XOR
+ * avec ces données. Une case écrite à moitié par un autre thread ne redonne
+ * pas la clé et est simplement vue comme absente.
+ */
+
+#ifndef TRANSPOSITION_H_INCLUDED
+#define TRANSPOSITION_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Valeur de case indiquant l'absence de meilleur coup */
+#define TT_NO_SQUARE 0xFF
+
+/**
+ * @enum TTBound
+ * @brief Nature du score enregistré
+ */
+typedef enum {
+    TT_EXACT = 0,   /**< Score exact (dans la fenêtre alpha-bêta) */
+    TT_LOWER,       /**< Borne inférieure (coupure bêta) */
+    TT_UPPER        /**< Borne supérieure (aucun coup n'a dépassé alpha) */
+} TTBound;
+
+/**
+ * @struct TTEntry
+ * @brief Entrée de la table de transposition, telle que décodée par tt_probe()
+ */
+typedef struct {
+    uint64_t key;           /**< Clé Zobrist complète de la position */
+    int32_t score;          /**< Score de la position */
+    int8_t depth;           /**< Profondeur restante de la recherche ayant produit le score */
+    uint8_t bound_gen;      /**< Borne (2 bits de poids faible) et génération (6 bits) */
+    uint8_t best_from;      /**< Case de départ du meilleur coup (TT_NO_SQUARE si aucun) */
+    uint8_t best_to;        /**< Case d'arrivée du meilleur coup (TT_NO_SQUARE si aucun) */
+} TTEntry;
+
+/** @brief Borne d'une entrée */
+static inline TTBound tt_entry_bound(const TTEntry *entry) {
+    return (TTBound)(entry->bound_gen & 3);
+}
+
+/**
+ * @brief Alloue (ou réalloue) la table de transposition
+ *
+ * Le nombre d'entrées est la plus grande puissance de deux tenant dans la
+ * taille demandée. Une taille nulle désactive la table.
+ *
+ * @param size_mb Taille maximale de la table en mégaoctets
+ * @return int 0 en cas de succès, -1 si l'allocation échoue
+ */
+int tt_init(size_t size_mb);
+
+/**
+ * @brief Libère la table de transposition
+ *
+ * @return void
+ */
+void tt_free(void);
+
+/**
+ * @brief Vide toutes les entrées de la table
+ *
+ * @return void
+ */
+void tt_clear(void);
+
+/**
+ * @brief Indique si la table est allouée
+ *
+ * @return int 1 si la table est utilisable, 0 sinon
+ */
+int tt_is_ready(void);
+
+/**
+ * @brief Signale le début d'une nouvelle recherche
+ *
+ * Incrémente la génération courante : les entrées des recherches précédentes
+ * restent consultables mais peuvent être remplacées quelle que soit leur profondeur.
+ *
+ * @return void
+ */
+void tt_new_search(void);
+
+/**
+ * @brief Cherche une position dans la table
+ *
+ * @param key Clé Zobrist de la position
+ * @param entry Copie de l'entrée trouvée (non modifiée si absente)
+ * @return int 1 si la position est présente, 0 sinon
+ */
+int tt_probe(uint64_t key, TTEntry *entry);
+
+/**
+ * @brief Enregistre le résultat d'une recherche
+ *
+ * @param key Clé Zobrist de la position
+ * @param depth Profondeur restante de la recherche
+ * @param score Score obtenu
+ * @param bound Nature du score
+ * @param best_from Case de départ du meilleur coup (TT_NO_SQUARE si aucun)
+ * @param best_to Case d'arrivée du meilleur coup (TT_NO_SQUARE si aucun)
+ * @return void
+ */
+void tt_store(uint64_t key, int depth, int score, TTBound bound, int best_from, int best_to);
+
+#endif // TRANSPOSITION_H_INCLUDED
@@ -0,0 +1,46 @@
+/**
+ * @file zobrist.h
+ * @brief Clés de hachage Zobrist des positions de jeu
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Ce fichier contient les déclarations pour le hachage Zobrist, incluant :
+ * - Les tables de clés aléatoires par case et par contenu de case, précalculées
+ * - La clé du joueur au trait
+ * - Le calcul complet de la clé d'une partie
+ *
+ * Les cases visitées (P1_VISITED, P2_VISITED) ont leurs propres clés : deux
+ * positions qui ne diffèrent que par leurs traces de passage ont donc des
+ * clés différentes, ce qui est nécessaire puisque ces traces comptent dans le score.
+ */
+
+#ifndef ZOBRIST_H_INCLUDED
+#define ZOBRIST_H_INCLUDED
+
+#include <stdint.h>
+
+#include "game.h"
+#include "const.h"
+
+/** @brief Taille de la table par case, indexée directement par l'octet de la Piece */
+#define ZOBRIST_PIECE_KINDS PIECE_VALUES
+
+/*
+ * ZOBRIST_PIECES et ZOBRIST_SIDE sont générées à la compilation par
+ * tools/gen_tables.c, à partir d'un générateur pseudo-aléatoire à graine
+ * fixe : une même position a toujours la même clé d'une exécution à l'autre.
+ */
+#include "zobrist_tables.h"
+
+/**
+ * @brief Calcule la clé complète d'une partie
+ *
+ * Parcourt tout le plateau ; la recherche maintient ensuite la clé de
+ * manière incrémentale à chaque coup joué ou annulé.
+ *
+ * @param game Partie à hacher
+ * @return uint64_t Clé Zobrist de la position (plateau et joueur au trait)
+ */
+uint64_t zobrist_hash(const Game *game);
+
+#endif // ZOBRIST_H_INCLUDED
@@ -15,9 +15,12 @@
  * - Client (connexion à un serveur distant)
  *
  * Utilisation :
- *   ./game [-ia] -l
- *   ./game [-ia] -s <port>
- *   ./game [-ia] -c <ip:port>
+ *   ./game [-ia] [-t <threads>] -l
+ *   ./game [-ia] [-t <threads>] -s <port>
+ *   ./game [-ia] [-t <threads>] -c <ip:port>
+ *
+ * L'option -t fixe le nombre de threads de recherche de l'IA
+ * (0 ou absente : un thread par cœur disponible).
  */
 
 #include <stdio.h>
@@ -94,6 +97,18 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // Check for -t <threads> and filter it out
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-t") == 0) {
+            ai_set_threads(atoi(argv[i + 1]));
+            for (int j = i; j < argc - 2; j++) {
+                argv[j] = argv[j + 2];
+            }
+            argc -= 2;
+            i--;
+        }
+    }
+
     if (argc == 1 || (argc >= 2 && strcmp(argv[1], "-l") == 0)) {
         // Mode LOCAL (2 joueurs sur la même machine)
         LOG_INFO_MSG("Démarrage en mode local%s...\n", ai_enabled ? " avec IA" : "");
@@ -146,6 +161,6 @@ int main(int argc, char *argv[]) {
 
     return initialize_display(0, NULL, &game);
 
-    fprintf(stderr, "Usage: %s [-ia] -l | [-ia] -s <port> | [-ia] -c <ip:port>\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-ia] [-t <threads>] -l | [-ia] [-t <threads>] -s <port> | [-ia] [-t <threads>] -c <ip:port>\n", argv[0]);
     return 1;
 }
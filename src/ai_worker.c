@@ -0,0 +1,232 @@
+/**
+ * @file ai_worker.c
+ * @brief Implémentation du thread de recherche de l'IA
+ *
+ * Ce fichier contient :
+ * - Le thread unique qui exécute les recherches de l'IA
+ * - Le dépôt des demandes (copie de la partie) sous mutex
+ * - L'annulation par identifiant de demande et drapeau atomique
+ * - L'application du coup dans la boucle GTK
+ *
+ * Chaque demande reçoit un identifiant croissant. Un coup n'est appliqué que
+ * si son identifiant est encore celui de la dernière demande : toute nouvelle
+ * demande ou annulation rend caduque la recherche précédente.
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "ai_worker.h"
+#include "display_gtk.h"
+#include "input.h"
+#include "logging.h"
+
+/**
+ * @struct ai_worker_t
+ * @brief État partagé entre la boucle GTK et le thread de l'IA
+ */
+typedef struct {
+    pthread_mutex_t lock;       /**< Protège tous les champs sauf cancel */
+    pthread_cond_t wakeup;      /**< Signale une nouvelle demande ou l'arrêt */
+    pthread_t thread;           /**< Thread de recherche */
+    int started;                /**< 1 si le thread a été lancé */
+    int quit;                   /**< 1 si le thread doit se terminer */
+
+    int has_job;                /**< 1 si une demande attend d'être prise par le thread */
+    Game snapshot;              /**< Copie de la partie à analyser */
+    int time_budget_ms;         /**< Temps de réflexion de la demande */
+
+    Game *target;               /**< Partie visée par la dernière demande (NULL si aucune) */
+    int target_turn;            /**< Tour visé par la dernière demande (-1 si aucune) */
+    unsigned long request_id;   /**< Identifiant de la dernière demande ou annulation */
+    atomic_int cancel;          /**< Interrompt la recherche en cours */
+} ai_worker_t;
+
+/** @brief Instance globale unique du thread de l'IA */
+static ai_worker_t g_worker = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wakeup = PTHREAD_COND_INITIALIZER,
+    .target_turn = -1,
+};
+
+/**
+ * @brief Boucle du thread de l'IA
+ *
+ * Attend une demande, cherche le meilleur coup sur la copie de la partie
+ * puis le transmet à la boucle GTK si la demande n'est pas devenue caduque.
+ *
+ * @param arg Non utilisé
+ * @return void* NULL
+ */
+static void *ai_worker_run(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&g_worker.lock);
+    while (1) {
+        while (!g_worker.has_job && !g_worker.quit) {
+            pthread_cond_wait(&g_worker.wakeup, &g_worker.lock);
+        }
+        if (g_worker.quit) break;
+
+        // Prise de la demande : le drapeau d'annulation ne concerne plus que celle-ci
+        Game snapshot = g_worker.snapshot;
+        Game *target = g_worker.target;
+        int time_budget_ms = g_worker.time_budget_ms;
+        unsigned long request_id = g_worker.request_id;
+        g_worker.has_job = 0;
+        atomic_store(&g_worker.cancel, 0);
+        pthread_mutex_unlock(&g_worker.lock);
+
+        Move best_move = minimax_best_move_cancellable(&snapshot, time_budget_ms, &g_worker.cancel);
+
+        pthread_mutex_lock(&g_worker.lock);
+        if (request_id != g_worker.request_id) {
+            LOG_INFO_MSG("[AI] Recherche du tour %d abandonnée", snapshot.turn);
+            continue;
+        }
+
+        // Remise du coup à la boucle GTK, seul canal de retour du thread
+        AIResult *result = g_new0(AIResult, 1);
+        result->game = target;
+        result->move = best_move;
+        result->turn = snapshot.turn;
+        result->request_id = request_id;
+        g_idle_add(ai_worker_deliver, result);
+    }
+    pthread_mutex_unlock(&g_worker.lock);
+    return NULL;
+}
+
+/**
+ * @brief Dépose une demande de recherche
+ *
+ * @param game Partie principale
+ * @return void
+ */
+void ai_worker_request(Game *game) {
+    pthread_mutex_lock(&g_worker.lock);
+
+    // La recherche de ce tour est déjà en cours ou en attente
+    if (g_worker.target == game && g_worker.target_turn == game->turn) {
+        pthread_mutex_unlock(&g_worker.lock);
+        return;
+    }
+
+    if (!g_worker.started) {
+        if (pthread_create(&g_worker.thread, NULL, ai_worker_run, NULL) != 0) {
+            pthread_mutex_unlock(&g_worker.lock);
+            LOG_ERROR_MSG("[AI] Échec du lancement du thread de l'IA");
+            return;
+        }
+        g_worker.started = 1;
+    }
+
+    // Une éventuelle recherche pour un autre tour est interrompue
+    atomic_store(&g_worker.cancel, 1);
+
+    g_worker.snapshot = *game;
+    g_worker.snapshot.is_ai = 0; // Prévention de la récursion dans l'IA
+    g_worker.time_budget_ms = ai_time_budget_ms(game);
+    g_worker.target = game;
+    g_worker.target_turn = game->turn;
+    g_worker.request_id++;
+    g_worker.has_job = 1;
+
+    LOG_INFO_MSG("[AI] Recherche confiée au thread de l'IA (tour %d, %d ms)", game->turn, g_worker.time_budget_ms);
+
+    pthread_cond_signal(&g_worker.wakeup);
+    pthread_mutex_unlock(&g_worker.lock);
+}
+
+/**
+ * @brief Annule la demande en cours
+ *
+ * @return void
+ */
+void ai_worker_cancel(void) {
+    pthread_mutex_lock(&g_worker.lock);
+    g_worker.request_id++;
+    g_worker.has_job = 0;
+    g_worker.target = NULL;
+    g_worker.target_turn = -1;
+    atomic_store(&g_worker.cancel, 1);
+    pthread_mutex_unlock(&g_worker.lock);
+}
+
+/**
+ * @brief Indique si une demande est en cours
+ *
+ * @return int 1 si une demande n'a pas encore été appliquée, 0 sinon
+ */
+int ai_worker_busy(void) {
+    pthread_mutex_lock(&g_worker.lock);
+    int busy = (g_worker.target != NULL);
+    pthread_mutex_unlock(&g_worker.lock);
+    return busy;
+}
+
+/**
+ * @brief Applique le coup du thread de l'IA dans la boucle GTK
+ *
+ * @param data Pointeur vers un AIResult
+ * @return gboolean G_SOURCE_REMOVE
+ */
+gboolean ai_worker_deliver(gpointer data) {
+    AIResult *result = (AIResult *)data;
+    Game *game = result->game;
+
+    // La demande est terminée : une nouvelle demande pourra être acceptée pour ce tour
+    pthread_mutex_lock(&g_worker.lock);
+    int current = (result->request_id == g_worker.request_id);
+    if (current) {
+        g_worker.target = NULL;
+        g_worker.target_turn = -1;
+    }
+    pthread_mutex_unlock(&g_worker.lock);
+
+    if (!current || game->won != NOT_PLAYER || game->turn != result->turn) {
+        LOG_INFO_MSG("[AI] Coup du tour %d ignoré : la partie a changé", result->turn);
+        g_free(result);
+        return G_SOURCE_REMOVE;
+    }
+
+    Move best_move = result->move;
+    g_free(result);
+
+    if (game->game_mode == LOCAL) {
+        if (best_move.src_row != -1 && best_move.src_col != -1 && best_move.dst_row != -1 && best_move.dst_col != -1) {
+            game->selected_tile[0] = best_move.src_row;
+            game->selected_tile[1] = best_move.src_col;
+            update_board(game, best_move.dst_row, best_move.dst_col);
+        }
+        display_request_redraw();
+    } else {
+        ai_network_play(game, best_move);
+    }
+
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Arrête le thread de l'IA
+ *
+ * @return void
+ */
+void ai_worker_shutdown(void) {
+    ai_worker_cancel();
+
+    pthread_mutex_lock(&g_worker.lock);
+    int started = g_worker.started;
+    g_worker.quit = 1;
+    pthread_cond_signal(&g_worker.wakeup);
+    pthread_mutex_unlock(&g_worker.lock);
+
+    if (started) {
+        pthread_join(g_worker.thread, NULL);
+        g_worker.started = 0;
+        g_worker.quit = 0;
+    }
+}
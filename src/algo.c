@@ -6,18 +6,125 @@
  * 
  * Ce fichier contient toutes les fonctions liées à l'IA du jeu, incluant :
  * - L'évaluation des positions (fonction utility)
- * - L'algorithme minimax avec élagage alpha-bêta
+ * - L'algorithme négamax avec élagage alpha-bêta (PVS, fenêtres d'aspiration)
+ * - La recherche de quiescence sur les captures
  * - La génération et le tri des mouvements possibles
  * - Les fonctions de simulation de mouvements pour l'IA
+ * - La recherche parallèle Lazy SMP
+ * - La recherche parallèle à profondeur fixe (coups racine et Young Brothers Wait)
+ * - Le comptage des feuilles de l'arbre des coups (perft)
  */
 
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
 
 #include "game.h"
 #include "algo.h"
+#include "bitboard.h"
+#include "mailbox.h"
+#include "zobrist.h"
+#include "transposition.h"
 #include "const.h"
 #include "logging.h"
 
+/**
+ * @brief Clé combinée à la clé Zobrist quand la recherche est menée pour P2
+ *
+ * L'évaluation est calculée du point de vue du joueur initial et n'est pas
+ * antisymétrique (bonus de fin de partie du roi) : une même position n'a pas
+ * le même score selon que la recherche est lancée pour P1 ou pour P2, il faut
+ * donc deux entrées distinctes dans la table.
+ */
+#define TT_PERSPECTIVE_P2 0x9D39247E33776D41ULL
+
+/** @brief Nombre maximal de plis depuis la racine, quiescence comprise */
+#define SEARCH_MAX_PLY (MAX_SEARCH_DEPTH + QUIESCENCE_MAX_DEPTH + 2)
+
+/** @brief Contextes de recherche libres conservés pour les recherches suivantes */
+#define SEARCH_CONTEXT_POOL_SIZE (YBW_MAX_LEVELS * AI_MAX_THREADS)
+
+/** @brief Borne des scores de recherche, au-delà de toute évaluation */
+#define SEARCH_INFINITY 100001
+
+/** @brief Demi-largeur initiale de la fenêtre d'aspiration autour du score précédent */
+#define ASPIRATION_WINDOW 150
+
+/** @brief Profondeur à partir de laquelle les itérations utilisent une fenêtre d'aspiration */
+#define ASPIRATION_MIN_DEPTH 3
+
+/** @brief Tour à partir duquel le score départage les joueurs (voir won()) */
+#define SCORE_HORIZON_TURN 63
+
+/** @brief Profondeur restante minimale pour essayer le coup nul */
+#define NULL_MOVE_MIN_DEPTH 3
+
+/** @brief Réduction de profondeur de la recherche après un coup nul */
+#define NULL_MOVE_REDUCTION 2
+
+/** @brief Profondeur restante minimale pour réduire les coups tardifs */
+#define LMR_MIN_DEPTH 3
+
+/** @brief Nombre de coups cherchés à pleine profondeur avant toute réduction */
+#define LMR_FULL_MOVES 3
+
+/** @brief Rang à partir duquel un coup calme est réduit de deux plis au lieu d'un */
+#define LMR_DEEP_MOVES 10
+
+/** @brief Profondeur restante jusqu'à laquelle s'appliquent l'élagage de futilité et le rasoir */
+#define FRONTIER_DEPTH 2
+
+/** @brief Gain maximal supposé d'un coup calme, par pli restant (élagage de futilité) */
+#define FUTILITY_MARGIN 500
+
+/** @brief Retard sur alpha, par pli restant, au-delà duquel seules les captures sont vérifiées (rasoir) */
+#define RAZOR_MARGIN 800
+
+/** @brief Nombre maximal de coups d'une pièce : 8 cases sur sa ligne et 8 sur sa colonne (évaluation paresseuse) */
+#define LAZY_EVAL_PIECE_MOVES (2 * (GRID_SIZE - 1))
+
+/** @brief Profondeur restante minimale d'un nœud partagé entre threads (Young Brothers Wait) */
+#define YBW_MIN_SPLIT_DEPTH 4
+
+/** @brief Capacité de la file de tâches de chaque thread */
+#define YBW_DEQUE_SIZE 256
+
+/** @brief Contextes par thread d'une recherche partagée : le principal, puis un par niveau d'imbrication des nœuds partagés */
+#define YBW_MAX_LEVELS 6
+
+/** @brief Valeurs de SearchContext.aborted */
+#define SEARCH_ABORT_TIME 1     // Échéance, arrêt ou annulation : toute la recherche s'arrête
+#define SEARCH_ABORT_SPLIT 2    // Coupure tardive d'un nœud partagé : seul ce nœud s'arrête
+
+// Priorités de tri des captures et menaces sur le roi (étape PICK_CAPTURES du sélecteur)
+#define ORDER_CAPTURE 100000        // Par pièce capturée
+#define ORDER_KING_CRITICAL 50000   // Roi adverse entouré par au moins deux pièces
+#define ORDER_KING_LIGHT 30000      // Roi adverse au contact d'une pièce
+#define HISTORY_MAX 16000           // Plafond de l'historique des coups calmes
+
+typedef struct SplitPoint SplitPoint;
+typedef struct SearchPool SearchPool;
+
+/**
+ * @struct SearchHeuristics
+ * @brief Heuristiques de tri des coups calmes apprises pendant la recherche
+ * 
+ * Les tables sont conservées d'un coup de la partie au suivant : en fin de
+ * recherche l'historique est divisé par deux, puis les tables sont reprises
+ * par la recherche suivante. Les killers, propres à chaque pli, sont rangés
+ * dans la pile de recherche (SearchFrame) et conservés de la même façon.
+ */
+typedef struct {
+    int history[2][BB_SQUARES][BB_SQUARES];             /**< Score des coups calmes coupants, par camp et case départ/arrivée */
+    PackedMove countermoves[BB_SQUARES][BB_SQUARES];    /**< Réponse coupante au coup adverse précédent, par case départ/arrivée de ce coup */
+} SearchHeuristics;
+
 /**
  * @struct UndoInfo
  * @brief Structure contenant les informations nécessaires pour annuler un mouvement
@@ -41,6 +148,232 @@ typedef struct {
     EatenPiece eaten[4]; /**< Tableau des pièces capturées (max 4) */
 } UndoInfo;
 
+/**
+ * @struct EvalState
+ * @brief Termes de l'évaluation tenus à jour à chaque écriture du plateau
+ * 
+ * Chaque terme est une somme de contributions case par case : update_board_ai()
+ * retire la contribution de l'ancien contenu et ajoute celle du nouveau.
+ * Indice 0 = P1, 1 = P2.
+ */
+typedef struct {
+    int16_t score[2];   /**< Score de partie : cases visitées + 2 par pièce (score_player_one/two) */
+    int16_t pieces[2];  /**< Nombre de pièces */
+    int16_t forward[2]; /**< Avancée vers le camp adverse (terme de util_forward) */
+    int16_t center[2];  /**< Pièces dans le carré central 3x3 */
+    int16_t tactics[2]; /**< Alliés voisins, diagonales comprises, sommés sur les pièces (util_tactics) */
+    int16_t king[2];    /**< Case du roi, -1 s'il a été capturé */
+} EvalState;
+
+/**
+ * @struct SearchPosition
+ * @brief Position simulée par la recherche, sans l'état de l'interface
+ * 
+ * Ne garde de Game que la position : plateau sous forme de bitboards, tour
+ * (le joueur au trait en est la parité) et victoire déjà acquise à la racine.
+ * S'y ajoutent la clé Zobrist et les termes de l'évaluation. Tous sont
+ * modifiés ensemble par update_board_ai() et undo_board_ai() afin que la
+ * génération de coups travaille directement sur les bitboards, que la table
+ * de transposition soit indexée sans recalculer la clé et qu'une feuille soit
+ * évaluée sans parcourir le plateau. Le contenu d'une case se lit dans les
+ * plans de bits (bitboard_piece_at()) : la position ne garde pas de copie du
+ * plateau et tient en 120 octets.
+ * 
+ * La position est construite une seule fois à la racine par
+ * search_position_from_game() ; elle ne pointe pas vers la partie et se
+ * copie telle quelle d'un thread à l'autre.
+ */
+typedef struct {
+    uint64_t hash;          /**< Clé Zobrist de la position (plateau et joueur au trait) */
+    int turn;               /**< Numéro du tour (pair = P1 au trait) */
+    int won;                /**< Victoire acquise à la racine (Player), NOT_PLAYER sinon */
+    BitboardPosition bb;    /**< Plans bitboard synchronisés avec le plateau */
+    EvalState eval;         /**< Termes de l'évaluation synchronisés avec le plateau */
+} SearchPosition;
+
+/**
+ * @enum PickStage
+ * @brief Étapes du sélecteur de coups, dans l'ordre où leurs coups sont produits
+ */
+typedef enum {
+    PICK_HASH,              /**< Meilleur coup de la table de transposition */
+    PICK_CAPTURES_GEN,      /**< Génération et score des captures et des menaces sur le roi */
+    PICK_CAPTURES,          /**< Captures et menaces, par score décroissant */
+    PICK_REFUTATIONS,       /**< Killers du pli puis contre-coup */
+    PICK_QUIET_GEN,         /**< Génération des coups calmes */
+    PICK_QUIET,             /**< Coups calmes, par historique décroissant */
+    PICK_DONE               /**< Tous les coups ont été produits */
+} PickStage;
+
+/**
+ * @struct MovePicker
+ * @brief Sélecteur de coups par étapes
+ * 
+ * Une étape n'est générée qu'une fois la précédente épuisée : à un nœud
+ * coupé par le coup de la table ou par une capture, les coups calmes ne
+ * sont jamais générés ni triés. Dans une étape, le meilleur coup restant
+ * est choisi à chaque appel au lieu de trier toute la liste.
+ * 
+ * Les coups produits sont ajoutés à moves, qui sert de liste des coups du
+ * nœud (SearchNode.moves) : un coup produit garde son rang.
+ */
+typedef struct {
+    PackedMove moves[10 * 16];      /**< Coups produits, dans l'ordre de production */
+    int size;                       /**< Nombre de coups produits */
+    int next;                       /**< Rang du prochain coup rendu par picker_next() */
+    PackedMove pending[10 * 16];    /**< Coups de l'étape en cours pas encore produits */
+    int scores[10 * 16];            /**< Scores de tri, parallèles à pending */
+    int pending_next;               /**< Premier coup de pending pas encore produit */
+    int pending_size;               /**< Fin (exclue) des coups de pending */
+    PickStage stage;                /**< Étape en cours */
+    Player player;                  /**< Joueur au trait */
+    PackedMove hash_move;           /**< Coup de la table, PACKED_MOVE_NONE si aucun */
+    PackedMove refutations[3];      /**< Killers du pli puis contre-coup */
+    int refutation;                 /**< Prochain élément de refutations à essayer */
+} MovePicker;
+
+/**
+ * @struct SearchFrame
+ * @brief Données d'un pli de la recherche
+ * 
+ * Les plis d'un contexte forment sa pile de recherche (SearchContext.stack),
+ * indexée par ply et allouée avec le contexte : un nœud n'a sur la pile C
+ * que quelques variables scalaires, et les listes de coups, les sélecteurs
+ * et les informations d'annulation sont réutilisés d'un nœud à l'autre.
+ */
+typedef struct {
+    MovePicker picker;              /**< Coups du nœud de search_negamax() */
+    PackedMove moves[10 * 16];      /**< Liste de coups brute : captures de la quiescence, coups racine */
+    UndoInfo undo;                  /**< Annulation du coup joué depuis ce pli */
+    PackedMove played;              /**< Coup joué depuis ce pli, PACKED_MOVE_NONE pour le coup nul */
+    PackedMove killers[2];          /**< Coups calmes ayant provoqué une coupure à ce pli */
+    PackedMove pv[SEARCH_MAX_PLY];  /**< Variation principale du pli (rangs ply à pv_length - 1) */
+    int pv_length;                  /**< Fin (exclue) de la variation */
+} SearchFrame;
+
+/**
+ * @struct SearchContext
+ * @brief État manipulé par la recherche de l'IA
+ * 
+ * Regroupe la position simulée, les compteurs de la recherche, les
+ * heuristiques de tri et la pile de recherche d'un thread. Un contexte
+ * occupe plusieurs centaines de kilo-octets : il est pris dans la réserve
+ * de search_context_acquire(), jamais sur la pile C.
+ */
+typedef struct {
+    SearchPosition pos;     /**< Position simulée */
+
+    unsigned long nodes;    /**< Nombre de nœuds visités depuis le début de la recherche */
+    unsigned long qnodes;           /**< Nœuds de quiescence parmi ces nœuds */
+    unsigned long expanded;         /**< Nœuds dont les coups ont été explorés (hors quiescence) */
+    unsigned long cutoffs;          /**< Coupures alpha-bêta (hors quiescence) */
+    unsigned long first_cutoffs;    /**< Coupures obtenues dès le premier coup essayé */
+    long long deadline_ms;  /**< Échéance en ms (horloge monotone), 0 si aucune limite */
+    atomic_int *stop;       /**< Arrêt demandé par le thread principal (NULL hors Lazy SMP) */
+    atomic_int *cancel;     /**< Annulation demandée par l'appelant (NULL si non annulable) */
+    int aborted;            /**< Cause de l'arrêt (SEARCH_ABORT_*), 0 sinon : la recherche remonte sans résultat */
+
+    int ply;                                /**< Distance à la racine du nœud courant */
+    SearchHeuristics *heuristics;           /**< Historique et contre-coups lus par le tri : own_heuristics, ou ceux du propriétaire du nœud partagé aidé */
+    SearchHeuristics own_heuristics;        /**< Historique et contre-coups appris par ce contexte */
+    SearchFrame stack[SEARCH_MAX_PLY];      /**< Pile de recherche, indexée par ply */
+
+    SearchPool *pool;       /**< Threads partageant les nœuds de la recherche (NULL si séquentielle) */
+    int thread_id;          /**< Numéro du thread dans pool */
+    int level;              /**< Niveau dans pool : 0 pour le contexte principal, n + 1 pour aider un nœud partagé de niveau n */
+    SplitPoint *split;      /**< Nœud partagé dont ce contexte cherche des coups (NULL sinon) */
+} SearchContext;
+
+/**
+ * @struct SearchNode
+ * @brief Paramètres d'un nœud de search_negamax() communs à tous ses coups
+ */
+typedef struct {
+    PackedMove *moves;      /**< Coups triés du nœud */
+    int size;               /**< Nombre de coups, renseigné quand tous les coups sont produits (partage) */
+    int depth;              /**< Profondeur restante au nœud */
+    int beta;               /**< Borne supérieure de la fenêtre, pour le joueur au trait */
+    Player initial_player;  /**< Joueur pour lequel la recherche est menée */
+    Player opponent;        /**< Adversaire du joueur au trait */
+    int futile;             /**< 1 si les coups calmes peuvent être élagués par futilité */
+    int attackers_before;   /**< Pièces au contact du roi adverse avant le coup (futilité) */
+} SearchNode;
+
+/**
+ * @struct SplitPoint
+ * @brief Nœud dont les coups sont cherchés par plusieurs threads (Young Brothers Wait)
+ * 
+ * Seuls les nœuds à fenêtre nulle sont partagés : alpha y reste constant et
+ * tout coup qui le dépasse provoque une coupure, signalée par aborted aux
+ * threads qui cherchent encore les autres coups. La structure vit sur la
+ * pile du thread propriétaire, qui attend la fin de toutes ses tâches.
+ * 
+ * Le propriétaire cherche lui aussi les coups partagés dans son contexte du
+ * niveau suivant : son contexte reste figé sur le nœud pendant le partage,
+ * et tous les threads y lisent la position et les heuristiques sans les
+ * recopier à l'avance.
+ */
+struct SplitPoint {
+    SearchNode node;                /**< Coups et paramètres du nœud */
+    int alpha;                      /**< Borne inférieure de la fenêtre (beta = alpha + 1) */
+    const SearchContext *owner;     /**< Contexte du propriétaire, figé sur le nœud pendant le partage */
+    SplitPoint *parent;             /**< Nœud partagé englobant, NULL sous la racine */
+    int level;                      /**< Niveau du contexte propriétaire ; les threads qui aident prennent le niveau suivant */
+
+    atomic_int next;                /**< Rang du prochain coup à chercher */
+    atomic_int aborted;             /**< 1 dès qu'une coupure rend les coups restants inutiles */
+    atomic_int stopped;             /**< 1 si un coup a été interrompu par l'échéance, l'arrêt ou l'annulation */
+    atomic_int tasks;               /**< Tâches publiées pour ce nœud et non terminées */
+
+    pthread_mutex_t lock;           /**< Protège le résultat ci-dessous */
+    int best_score;                 /**< Meilleur score trouvé */
+    int best_index;                 /**< Rang du coup correspondant, -1 si aucun */
+    int best_quiet;                 /**< 1 si ce coup ne capture rien */
+};
+
+/**
+ * @struct TaskDeque
+ * @brief File de tâches d'un thread : ses nœuds partagés en attente d'aide
+ * 
+ * Le propriétaire ajoute et reprend ses tâches par le bas ; les autres
+ * threads volent les plus anciennes, proches de la racine, par le haut.
+ */
+typedef struct {
+    pthread_mutex_t lock;                   /**< Protège la file */
+    SplitPoint *tasks[YBW_DEQUE_SIZE];      /**< Une entrée par thread attendu au nœud */
+    int top;                                /**< Plus ancienne tâche */
+    int bottom;                             /**< Fin (exclue) de la file */
+} TaskDeque;
+
+/**
+ * @struct SearchPool
+ * @brief Threads d'une recherche parallèle à profondeur fixe et leurs files de tâches
+ * 
+ * Chaque thread dispose d'un contexte par niveau, pris dans la réserve
+ * avant le début de la recherche (search_pool_init()) : aider un nœud
+ * partagé de niveau n occupe le contexte de niveau n + 1 du thread, jamais
+ * un contexte alloué en cours de recherche.
+ */
+struct SearchPool {
+    int thread_count;                       /**< Nombre de threads */
+    int levels;                             /**< Contextes par thread */
+    TaskDeque deques[AI_MAX_THREADS];       /**< File de chaque thread */
+    SearchContext *contexts[AI_MAX_THREADS][YBW_MAX_LEVELS];  /**< Contextes de chaque thread, par niveau */
+};
+
+/**
+ * @brief Indique si une coupure a été trouvée à un nœud partagé ou à l'un de ses ancêtres
+ * 
+ * @param split Nœud partagé (NULL accepté)
+ * @return int 1 si les coups restants de ce nœud sont inutiles, 0 sinon
+ */
+static inline int split_aborted(const SplitPoint *split) {
+    for (; split; split = split->parent) {
+        if (atomic_load_explicit(&split->aborted, memory_order_relaxed)) return 1;
+    }
+    return 0;
+}
+
 UtilWeights W = {
     .WIN = 5000,
     .LOSS = -5000,
@@ -57,115 +390,404 @@ UtilWeights W = {
 };
 
 /**
- * @brief Vérifie et applique les captures lors d'un mouvement de l'IA
+ * @brief Contribution d'une pièce (pion ou roi) d'un camp connu à la compilation
  * 
- * Cette fonction examine les cases adjacentes à la position donnée pour détecter
- * des pièces adverses qui peuvent être capturées selon les règles du jeu.
- * Elle met à jour la structure UndoInfo avec les informations des captures.
+ * Les voisins sont lus dans les bitboards, qui ne doivent pas encore refléter
+ * la modification de la case elle-même. Appelée directement par les coups de
+ * la recherche, où le camp de la pièce jouée et celui des pièces capturées
+ * sont connus.
  * 
- * @param game Pointeur vers la structure de jeu
- * @param row Ligne de la position à examiner
- * @param col Colonne de la position à examiner  
- * @param sprint_direction Direction du mouvement effectué
- * @param undo Pointeur vers la structure UndoInfo à mettre à jour
+ * @param pos Position simulée
+ * @param square Case modifiée
+ * @param piece Pion ou roi du camp side
+ * @param side Camp de la pièce (0 = P1, 1 = P2), constant à chaque appel
+ * @param sign 1 pour ajouter la contribution, -1 pour la retirer
  */
-void did_eat_ai(Game *game, int row, int col, Direction sprint_direction, UndoInfo *undo) {
-    undo->eaten_count = 0; // Réinitialisation du compteur de captures
+SIDE_SPECIALIZED void eval_put_piece(SearchPosition *pos, int square, Piece piece, int side, int sign) {
+    EvalState *eval = &pos->eval;
 
-    // Détermination des joueurs actuel et adverse
-    Player player = ((game->turn & 1) == 0) ? P1 : P2;
-    Player opponent = (player == P1) ? P2 : P1;
+    eval->score[side] += 2 * sign;
+    eval->pieces[side] += sign;
+    eval->forward[side] += sign * EVAL_FORWARD[side][square];
+    eval->center[side] += sign * EVAL_CENTER[square];
 
-    // Vérification des cases adjacentes pour détecter les adversaires
-    Player top = (row - 1 >= 0) ? get_player(game->board[row - 1][col]) : NOT_PLAYER;
-    Player left = (col - 1 >= 0) ? get_player(game->board[row][col - 1]) : NOT_PLAYER;
-    Player right = (col + 1 <= 8) ? get_player(game->board[row][col + 1]) : NOT_PLAYER;
-    Player down = (row + 1 <= 8) ? get_player(game->board[row + 1][col]) : NOT_PLAYER;
+    // Chaque paire d'alliés voisins compte une fois pour chacune des deux pièces
+    eval->tactics[side] += sign * 2 * bb_popcount(bb_and(BB_SURROUNDING[square], pos->bb.pieces[side]));
 
-    // Si haut est un adversaire et qu'il peut être capturé
-    if (top == opponent) {
-        if (((row - 2 < 0 || get_player(game->board[row - 2][col]) != opponent) && sprint_direction == DIR_TOP) ||
-            (get_player(game->board[row - 2][col]) == player && row - 2 >= 0)) {
+    if (piece_is_king(piece)) {
+        if (sign > 0) eval->king[side] = square;
+        else if (eval->king[side] == square) eval->king[side] = -1;
+    }
+}
 
-            undo->eaten[undo->eaten_count].row = row - 1;
-            undo->eaten[undo->eaten_count].col = col;
-            undo->eaten[undo->eaten_count].piece = game->board[row - 1][col];
-            undo->eaten_count++;
-            game->board[row - 1][col] = P_NONE;
-        }
+/**
+ * @brief Ajoute ou retire la contribution d'une case aux termes de l'évaluation
+ * 
+ * Les voisins sont lus dans les bitboards, qui ne doivent pas encore refléter
+ * la modification de la case elle-même (une case n'est pas sa propre voisine,
+ * l'ordre avec bitboard_put() est donc indifférent).
+ * 
+ * @param pos Position simulée
+ * @param square Case modifiée
+ * @param piece Contenu ajouté (sign = 1) ou retiré (sign = -1)
+ * @param sign 1 pour ajouter la contribution, -1 pour la retirer
+ */
+static inline void eval_put(SearchPosition *pos, int square, Piece piece, int sign) {
+    switch (piece) {
+        case P_NONE:
+            return;
+        case P1_VISITED:
+            pos->eval.score[0] += sign;
+            return;
+        case P2_VISITED:
+            pos->eval.score[1] += sign;
+            return;
+        default:
+            break;
+    }
+
+    if (piece_owner(piece) == P1) eval_put_piece(pos, square, piece, 0, sign);
+    else eval_put_piece(pos, square, piece, 1, sign);
+}
+
+/**
+ * @brief Calcule les termes de l'évaluation à partir du plateau
+ * 
+ * @param pos Position dont les bitboards sont à jour
+ */
+static void eval_init(SearchPosition *pos) {
+    EvalState empty = {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {-1, -1}};
+    pos->eval = empty;
+
+    // Les pièces sont ajoutées une à une pour que les paires d'alliés soient comptées correctement
+    BitboardPosition full = pos->bb;
+    BitboardPosition none = {{{0, 0}, {0, 0}}, {0, 0}, {{0, 0}, {0, 0}}};
+    pos->bb = none;
+    for (int square = 0; square < BB_SQUARES; square++) {
+        Piece piece = bitboard_piece_at(&full, square);
+        eval_put(pos, square, piece, 1);
+        bitboard_put(&pos->bb, square, piece);
+    }
+    pos->bb = full;
+}
+
+/**
+ * @brief Construit la position de la recherche à partir d'une partie
+ * 
+ * Seule conversion depuis Game : la recherche ne lit ni n'écrit plus la
+ * partie ensuite.
+ * 
+ * @param pos Position à remplir
+ * @param game Partie à la racine de la recherche
+ */
+static void search_position_from_game(SearchPosition *pos, const Game *game) {
+    bitboard_from_game(&pos->bb, game);
+    pos->hash = zobrist_hash(game);
+    pos->turn = game->turn;
+    pos->won = game->won;
+    eval_init(pos);
+}
+
+/**
+ * @brief Initialise un contexte de recherche sur une position
+ * 
+ * @param ctx Contexte à initialiser
+ * @param pos Position recopiée dans le contexte
+ */
+static void search_context_init(SearchContext *ctx, const SearchPosition *pos) {
+    ctx->pos = *pos;
+    ctx->nodes = 0;
+    ctx->qnodes = 0;
+    ctx->expanded = 0;
+    ctx->cutoffs = 0;
+    ctx->first_cutoffs = 0;
+    ctx->deadline_ms = 0;
+    ctx->stop = NULL;
+    ctx->cancel = NULL;
+    ctx->aborted = 0;
+    ctx->ply = 0;
+    ctx->heuristics = &ctx->own_heuristics;
+    ctx->stack[0].pv_length = 0;
+    ctx->pool = NULL;
+    ctx->thread_id = 0;
+    ctx->level = 0;
+    ctx->split = NULL;
+}
+
+/**
+ * @brief Initialise un contexte de recherche à partir d'une partie
+ * 
+ * @param ctx Contexte à initialiser
+ * @param game Partie à la racine de la recherche (non modifiée)
+ */
+static void search_context_from_game(SearchContext *ctx, const Game *game) {
+    SearchPosition pos;
+    search_position_from_game(&pos, game);
+    search_context_init(ctx, &pos);
+}
+
+/** @brief Contextes libres conservés entre deux recherches */
+static SearchContext *g_context_pool[SEARCH_CONTEXT_POOL_SIZE];
+
+/** @brief Nombre de contextes dans g_context_pool */
+static int g_context_pool_count = 0;
+
+/** @brief Protège g_context_pool (recherches lancées depuis plusieurs threads) */
+static pthread_mutex_t g_context_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Fournit un contexte de recherche non initialisé
+ * 
+ * Les contextes rendus par search_context_release() sont réutilisés : une
+ * recherche n'alloue de mémoire que si la réserve est vide, en pratique
+ * lors de la première recherche de chaque thread.
+ * 
+ * @return SearchContext* Contexte à initialiser, NULL si l'allocation échoue
+ */
+static SearchContext *search_context_acquire(void) {
+    SearchContext *ctx = NULL;
+
+    pthread_mutex_lock(&g_context_pool_lock);
+    if (g_context_pool_count > 0) ctx = g_context_pool[--g_context_pool_count];
+    pthread_mutex_unlock(&g_context_pool_lock);
+
+    if (ctx == NULL) ctx = malloc(sizeof(SearchContext));
+    return ctx;
+}
+
+/**
+ * @brief Rend un contexte obtenu par search_context_acquire()
+ * 
+ * @param ctx Contexte à rendre (NULL accepté)
+ */
+static void search_context_release(SearchContext *ctx) {
+    if (ctx == NULL) return;
+
+    pthread_mutex_lock(&g_context_pool_lock);
+    if (g_context_pool_count < SEARCH_CONTEXT_POOL_SIZE) {
+        g_context_pool[g_context_pool_count++] = ctx;
+        ctx = NULL;
     }
-    // Si gauche est un adversaire et qu'il peut être capturé
-    if (left == opponent) {
-        if (((col - 2 < 0 || get_player(game->board[row][col - 2]) != opponent) && sprint_direction == DIR_LEFT) ||
-            (get_player(game->board[row][col - 2]) == player && col - 2 >= 0)) {
+    pthread_mutex_unlock(&g_context_pool_lock);
+
+    free(ctx);
+}
+
+/**
+ * @brief Efface des heuristiques de tri (historique et contre-coups)
+ * 
+ * @param heuristics Heuristiques à effacer
+ */
+static void heuristics_clear(SearchHeuristics *heuristics) {
+    // PACKED_MOVE_NONE vaut 0 : les contre-coups sont effacés avec l'historique
+    memset(heuristics, 0, sizeof(*heuristics));
+}
 
-            undo->eaten[undo->eaten_count].row = row;
-            undo->eaten[undo->eaten_count].col = col - 1;
-            undo->eaten[undo->eaten_count].piece = game->board[row][col - 1];
-            undo->eaten_count++;
-            game->board[row][col - 1] = P_NONE;
+/**
+ * @brief Vieillit des heuristiques avant la recherche du coup suivant
+ * 
+ * L'historique est divisé par deux pour que les coupures récentes pèsent
+ * plus que les anciennes ; les contre-coups, indexés par le coup adverse,
+ * sont conservés tels quels.
+ * 
+ * @param heuristics Heuristiques à vieillir
+ */
+static void heuristics_age(SearchHeuristics *heuristics) {
+    for (int side = 0; side < 2; side++) {
+        for (int from = 0; from < BB_SQUARES; from++) {
+            for (int to = 0; to < BB_SQUARES; to++) heuristics->history[side][from][to] /= 2;
         }
     }
+}
+
+/** @brief Heuristiques conservées entre deux recherches */
+static SearchHeuristics g_heuristics;
+
+/** @brief Killers conservés entre deux recherches, par pli */
+static PackedMove g_killers[SEARCH_MAX_PLY][2];
+
+/** @brief 1 une fois g_heuristics et g_killers initialisés */
+static int g_heuristics_ready = 0;
+
+/** @brief Protège g_heuristics et g_killers (l'IA cherche dans un thread séparé de l'interface) */
+static pthread_mutex_t g_heuristics_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Efface les heuristiques de tri du contexte
+ * 
+ * Séparé de search_context_init() : une simple évaluation n'a pas besoin
+ * de ces tables, seule une recherche les utilise.
+ * 
+ * @param ctx Contexte de recherche
+ */
+static void search_context_clear_heuristics(SearchContext *ctx) {
+    heuristics_clear(&ctx->own_heuristics);
+    for (int ply = 0; ply < SEARCH_MAX_PLY; ply++) {
+        ctx->stack[ply].killers[0] = PACKED_MOVE_NONE;
+        ctx->stack[ply].killers[1] = PACKED_MOVE_NONE;
+    }
+}
 
-    // Si droite est un adversaire et qu'il peut être capturé
-    if (right == opponent) {
-        if (((col + 2 > 8 || get_player(game->board[row][col + 2]) != opponent) && sprint_direction == DIR_RIGHT) ||
-            (get_player(game->board[row][col + 2]) == player && col + 2 <= 8)) {
+/**
+ * @brief Reprend dans le contexte les heuristiques de la recherche précédente
+ * 
+ * @param ctx Contexte de recherche
+ */
+static void search_context_load_heuristics(SearchContext *ctx) {
+    pthread_mutex_lock(&g_heuristics_lock);
+    if (!g_heuristics_ready) {
+        heuristics_clear(&g_heuristics);
+        memset(g_killers, 0, sizeof(g_killers));
+        g_heuristics_ready = 1;
+    }
+    ctx->own_heuristics = g_heuristics;
+    for (int ply = 0; ply < SEARCH_MAX_PLY; ply++) {
+        ctx->stack[ply].killers[0] = g_killers[ply][0];
+        ctx->stack[ply].killers[1] = g_killers[ply][1];
+    }
+    pthread_mutex_unlock(&g_heuristics_lock);
+}
 
-            undo->eaten[undo->eaten_count].row = row;
-            undo->eaten[undo->eaten_count].col = col + 1;
-            undo->eaten[undo->eaten_count].piece = game->board[row][col + 1];
-            undo->eaten_count++;
-            game->board[row][col + 1] = P_NONE;
+/**
+ * @brief Conserve les heuristiques d'une recherche terminée, vieillies pour la suivante
+ * 
+ * Deux plis ont été joués entre deux recherches du même camp : les killers
+ * du pli p + 2 deviennent ceux du pli p.
+ * 
+ * @param ctx Contexte de recherche
+ */
+static void search_context_save_heuristics(const SearchContext *ctx) {
+    pthread_mutex_lock(&g_heuristics_lock);
+    g_heuristics = *ctx->heuristics;
+    heuristics_age(&g_heuristics);
+    for (int ply = 0; ply < SEARCH_MAX_PLY; ply++) {
+        for (int slot = 0; slot < 2; slot++) {
+            g_killers[ply][slot] = (ply + 2 < SEARCH_MAX_PLY) ? ctx->stack[ply + 2].killers[slot] : PACKED_MOVE_NONE;
         }
     }
+    g_heuristics_ready = 1;
+    pthread_mutex_unlock(&g_heuristics_lock);
+}
+
+/**
+ * @brief Oublie les heuristiques de tri conservées entre deux recherches
+ * 
+ * À appeler en début de partie, ou avant chaque position d'un benchmark
+ * pour que le nombre de nœuds ne dépende pas des positions précédentes.
+ */
+void ai_reset_heuristics(void) {
+    pthread_mutex_lock(&g_heuristics_lock);
+    heuristics_clear(&g_heuristics);
+    memset(g_killers, 0, sizeof(g_killers));
+    g_heuristics_ready = 1;
+    pthread_mutex_unlock(&g_heuristics_lock);
+}
 
-    // Si bas est un adversaire et qu'il peut être capturé
-    if (down == opponent) {
-        if (((row + 2 > 8 || get_player(game->board[row + 2][col]) != opponent) && sprint_direction == DIR_DOWN) ||
-            (get_player(game->board[row + 2][col]) == player && row + 2 <= 8)) {
+/**
+ * @brief Temps écoulé sur l'horloge monotone
+ * 
+ * @return long long Temps courant en millisecondes
+ */
+static long long now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/**
+ * @brief Écrit une case du plateau et met à jour les bitboards et la clé
+ * 
+ * Toute écriture dans le plateau pendant la recherche passe par cette
+ * fonction pour garder les bitboards et la clé Zobrist synchronisés. Les
+ * termes de l'évaluation sont mis à jour par l'appelant
+ * (eval_put(), eval_put_piece()), qui connaît en général le camp des pièces.
+ * 
+ * @param pos Position simulée
+ * @param row Ligne de la case
+ * @param col Colonne de la case
+ * @param old Contenu actuel de la case
+ * @param piece Nouveau contenu de la case
+ */
+static inline void set_cell(SearchPosition *pos, int row, int col, Piece old, Piece piece) {
+    int square = BB_SQUARE(row, col);
+    pos->hash ^= ZOBRIST_PIECES[square][old] ^ ZOBRIST_PIECES[square][piece];
+    bitboard_put(&pos->bb, square, piece);
+}
 
-            undo->eaten[undo->eaten_count].row = row + 1;
-            undo->eaten[undo->eaten_count].col = col;
-            undo->eaten[undo->eaten_count].piece = game->board[row + 1][col];
-            undo->eaten_count++;
-            game->board[row + 1][col] = P_NONE;
+/**
+ * @brief Pièces capturées par une pièce du camp side arrivée sur une case
+ * 
+ * Même règle que mailbox_captures() : une pièce adverse voisine est prise si
+ * un allié la flanque de l'autre côté (sandwich), ou si elle est dans la
+ * direction du déplacement et que la case derrière elle n'est pas une pièce
+ * adverse ou est hors du plateau (sprint).
+ * 
+ * @param bb Plateau, la pièce jouée déjà posée sur square
+ * @param square Case d'arrivée
+ * @param sprint_direction Direction du déplacement
+ * @param side Camp de la pièce jouée (0 = P1, 1 = P2), constant à chaque appel
+ * @param captured Cases des pièces capturées
+ * @return int Nombre de pièces capturées (0 à 4)
+ */
+SIDE_SPECIALIZED int captures_side(const BitboardPosition *bb, int square, Direction sprint_direction, int side, int captured[4]) {
+    int count = 0;
+
+    for (int d = 0; d < 4; d++) {
+        int neighbour = BB_NEIGHBOUR[square][d];
+        if (neighbour < 0 || !bb_test(bb->pieces[1 - side], neighbour)) continue;
+
+        // Case derrière l'adversaire, -1 si le voisin est au bord
+        int behind = BB_NEIGHBOUR[neighbour][d];
+        if (behind >= 0 && bb_test(bb->pieces[side], behind)) {
+            captured[count++] = neighbour;
+        } else if (sprint_direction == (Direction)d && (behind < 0 || !bb_test(bb->pieces[1 - side], behind))) {
+            captured[count++] = neighbour;
         }
     }
+    return count;
 }
 
 /**
- * @brief Applique un mouvement sur le plateau pour les simulations de l'IA
+ * @brief Applique un coup du camp side, connu à la compilation
  * 
- * Cette fonction met à jour le plateau de jeu en appliquant un mouvement donné.
- * Elle gère également les captures résultantes et sauvegarde les informations
- * nécessaires pour pouvoir annuler le mouvement.
+ * La pièce jouée appartient au camp au trait et les pièces capturées à son
+ * adversaire : les termes de l'évaluation, la case visitée laissée au départ
+ * et la règle de capture n'ont pas à tester le propriétaire des pièces.
  * 
- * @param game Pointeur vers la structure de jeu à modifier
- * @param dst_row Ligne de destination du mouvement
- * @param dst_col Colonne de destination du mouvement
- * @return UndoInfo Structure contenant les informations pour annuler le mouvement
+ * @param pos Position simulée, side au trait
+ * @param move Mouvement à appliquer
+ * @param undo Informations d'annulation à remplir
+ * @param side Camp au trait (0 = P1, 1 = P2), constant à chaque appel
  */
-UndoInfo update_board_ai(Game *game, int dst_row, int dst_col) {
-    UndoInfo undo;
-    // Récupération de la position source sélectionnée
-    int src_row = game->selected_tile[0];
-    int src_col = game->selected_tile[1];
+SIDE_SPECIALIZED void make_move_side(SearchPosition *pos, PackedMove move, UndoInfo *undo, int side) {
+    int from = packed_from(move);
+    int to = packed_to(move);
+    int src_row = from / GRID_SIZE;
+    int src_col = from % GRID_SIZE;
+    int dst_row = to / GRID_SIZE;
+    int dst_col = to % GRID_SIZE;
+    Piece moved = bitboard_piece_at(&pos->bb, from);
+    Piece target = bitboard_piece_at(&pos->bb, to);
 
     // Initialisation de la structure d'annulation
-    undo.src_row = src_row;
-    undo.src_col = src_col;
-    undo.dst_row = dst_row;
-    undo.dst_col = dst_col;
-    undo.src_piece = game->board[src_row][src_col];
-    undo.dst_piece = game->board[dst_row][dst_col];
-    undo.turn_before = game->turn;
-    undo.won_before = game->won;
-    undo.eaten_count = 0;
-
-    // Application du mouvement sur le plateau
-    game->board[dst_row][dst_col] = undo.src_piece;
-    game->board[src_row][src_col] = (get_player(undo.src_piece) == P1) ? P1_VISITED : P2_VISITED;
+    undo->src_row = src_row;
+    undo->src_col = src_col;
+    undo->dst_row = dst_row;
+    undo->dst_col = dst_col;
+    undo->src_piece = moved;
+    undo->dst_piece = target;
+    undo->turn_before = pos->turn;
+    undo->won_before = pos->won;
+
+    // Arrivée sur une case vide ou visitée
+    eval_put(pos, to, target, -1);
+    eval_put_piece(pos, to, moved, side, 1);
+    set_cell(pos, dst_row, dst_col, target, moved);
+
+    // Départ : la pièce laisse une case visitée de son camp
+    eval_put_piece(pos, from, moved, side, -1);
+    pos->eval.score[side] += 1;
+    set_cell(pos, src_row, src_col, moved, side ? P2_VISITED : P1_VISITED);
 
     // Détermination de la direction du mouvement pour les captures
     Direction direction;
@@ -174,14 +796,75 @@ UndoInfo update_board_ai(Game *game, int dst_row, int dst_col) {
     } else {
         direction = (src_col > dst_col) ? DIR_LEFT : DIR_RIGHT;
     }
-    
-    // Vérification et application des captures
-    did_eat_ai(game, dst_row, dst_col, direction, &undo);
+
+    // Captures : toutes trouvées avant d'en retirer une
+    int captured[4];
+    undo->eaten_count = captures_side(&pos->bb, to, direction, side, captured);
+    for (int i = 0; i < undo->eaten_count; i++) {
+        int eaten_row = captured[i] / GRID_SIZE;
+        int eaten_col = captured[i] % GRID_SIZE;
+        Piece victim = bitboard_piece_at(&pos->bb, captured[i]);
+        undo->eaten[i].row = eaten_row;
+        undo->eaten[i].col = eaten_col;
+        undo->eaten[i].piece = victim;
+        eval_put_piece(pos, BB_SQUARE(eaten_row, eaten_col), victim, 1 - side, -1);
+        set_cell(pos, eaten_row, eaten_col, victim, P_NONE);
+    }
 
     // Avancement du tour (won() est commenté pour éviter les effets de bord)
-    game->turn++;
+    pos->turn++;
+    pos->hash ^= ZOBRIST_SIDE;
+}
+
+/**
+ * @brief Annule un coup du camp side, connu à la compilation
+ * 
+ * @param pos Position simulée à restaurer
+ * @param undo Informations remplies par make_move_side()
+ * @param side Camp qui avait joué le coup (0 = P1, 1 = P2), constant à chaque appel
+ */
+SIDE_SPECIALIZED void unmake_move_side(SearchPosition *pos, const UndoInfo *undo, int side) {
+    Piece moved = undo->src_piece;
+    int from = BB_SQUARE(undo->src_row, undo->src_col);
+    int to = BB_SQUARE(undo->dst_row, undo->dst_col);
+
+    // Restauration des positions des pièces
+    pos->eval.score[side] -= 1;
+    eval_put_piece(pos, from, moved, side, 1);
+    set_cell(pos, undo->src_row, undo->src_col, side ? P2_VISITED : P1_VISITED, moved);
+
+    eval_put_piece(pos, to, moved, side, -1);
+    eval_put(pos, to, undo->dst_piece, 1);
+    set_cell(pos, undo->dst_row, undo->dst_col, moved, undo->dst_piece);
+
+    // Restauration des pièces capturées, toutes adverses
+    for (int i = 0; i < undo->eaten_count; i++) {
+        const EatenPiece *eaten = &undo->eaten[i];
+        eval_put_piece(pos, BB_SQUARE(eaten->row, eaten->col), eaten->piece, 1 - side, 1);
+        set_cell(pos, eaten->row, eaten->col, P_NONE, eaten->piece);
+    }
+
+    // Restauration de l'état du jeu
+    pos->turn = undo->turn_before;
+    pos->won = undo->won_before;
+    pos->hash ^= ZOBRIST_SIDE;
+}
 
-    return undo;
+/**
+ * @brief Applique un mouvement sur le plateau pour les simulations de l'IA
+ * 
+ * Cette fonction met à jour le plateau de jeu en appliquant un mouvement donné.
+ * Elle gère également les captures résultantes et sauvegarde les informations
+ * nécessaires pour pouvoir annuler le mouvement. Le camp au trait est testé
+ * une fois, puis le coup est joué par la variante de ce camp.
+ * 
+ * @param pos Position simulée
+ * @param move Mouvement à appliquer (codé sur 16 bits)
+ * @param undo Informations d'annulation à remplir (en général celles du pli, SearchFrame.undo)
+ */
+void update_board_ai(SearchPosition *pos, PackedMove move, UndoInfo *undo) {
+    if (pos->turn & 1) make_move_side(pos, move, undo, 1);
+    else make_move_side(pos, move, undo, 0);
 }
 
 /**
@@ -191,22 +874,12 @@ UndoInfo update_board_ai(Game *game, int dst_row, int dst_col) {
  * sauvegardées dans la structure UndoInfo. Elle remet en place toutes les
  * pièces à leur position d'origine et restaure l'état du jeu.
  * 
- * @param game Pointeur vers la structure de jeu à restaurer
- * @param undo Structure contenant les informations de restauration
+ * @param pos Position simulée à restaurer
+ * @param undo Informations remplies par update_board_ai()
  */
-void undo_board_ai(Game *game, UndoInfo undo) {
-    // Restauration des positions des pièces
-    game->board[undo.src_row][undo.src_col] = undo.src_piece;
-    game->board[undo.dst_row][undo.dst_col] = undo.dst_piece;
-
-    // Restauration des pièces capturées
-    for (int i = 0; i < undo.eaten_count; i++) {
-        game->board[undo.eaten[i].row][undo.eaten[i].col] = undo.eaten[i].piece;
-    }
-
-    // Restauration de l'état du jeu
-    game->turn = undo.turn_before;
-    game->won = undo.won_before;
+void undo_board_ai(SearchPosition *pos, const UndoInfo *undo) {
+    if (undo->turn_before & 1) unmake_move_side(pos, undo, 1);
+    else unmake_move_side(pos, undo, 0);
 }
 
 
@@ -226,7 +899,7 @@ void update_with_move(Game * game, Move move) {
     // Mise à jour directe du plateau sans utiliser update_board_ai (réservé aux simulations IA)
     Piece moving_piece = game->board[move.src_row][move.src_col];
     game->board[move.dst_row][move.dst_col] = moving_piece;
-    game->board[move.src_row][move.src_col] = (get_player(moving_piece) == P1) ? P1_VISITED : P2_VISITED;
+    game->board[move.src_row][move.src_col] = piece_visited_by(piece_owner(moving_piece));
 
     // Vérification et application des captures éventuelles après le mouvement
     Direction direction = NONE;
@@ -246,10 +919,56 @@ void update_with_move(Game * game, Move move) {
     }
 }
 
+/**
+ * @brief Écrit un coup en notation réseau ("A1B2")
+ *
+ * Colonne A à I puis ligne 1 à 9 (la ligne 9 est en haut du plateau) de la
+ * case de départ, puis de la case d'arrivée.
+ *
+ * @param move Coup à écrire (coordonnées valides)
+ * @param notation Tampon de sortie, terminé par '\0'
+ * @return void
+ */
+void move_to_notation(Move move, char notation[5]) {
+    notation[0] = (char)('A' + move.src_col);
+    notation[1] = (char)('0' + GRID_SIZE - move.src_row);
+    notation[2] = (char)('A' + move.dst_col);
+    notation[3] = (char)('0' + GRID_SIZE - move.dst_row);
+    notation[4] = '\0';
+}
+
+/**
+ * @brief Lit un coup en notation réseau ("A1B2")
+ *
+ * Seuls les quatre premiers caractères sont lus ; la légalité du coup n'est
+ * pas vérifiée.
+ *
+ * @param notation Coup en notation réseau
+ * @param move Coup lu (score -1), non modifié en cas d'erreur
+ * @return int 0 si la notation désigne deux cases du plateau, -1 sinon
+ */
+int move_from_notation(const char *notation, Move *move) {
+    int coords[4];
+
+    for (int i = 0; i < 4; i++) {
+        // Colonne pour les caractères pairs, ligne pour les impairs
+        int value = (i % 2 == 0) ? notation[i] - 'A' : GRID_SIZE - (notation[i] - '0');
+        if (notation[i] == '\0' || value < 0 || value >= GRID_SIZE) return -1;
+        coords[i] = value;
+    }
+
+    move->src_row = coords[1];
+    move->src_col = coords[0];
+    move->dst_row = coords[3];
+    move->dst_col = coords[2];
+    move->score = -1;
+    return 0;
+}
+
 // ÉVALUATION DES PIÈCES : Compter les pièces (facteur principal)
-int util_pieces(Game* game, Player player) {
-    int pieces_p1 = score_player_one(*game);
-    int pieces_p2 = score_player_two(*game);
+int util_pieces(const Game* game, Player player) {
+    int pieces_p1 = player_score(game, P1);
+    int pieces_p2 = player_score(game, P2);
     
     int piece_value = (pieces_p1 <= ENDGAME_PIECE_THRESHOLD || pieces_p2 <= ENDGAME_PIECE_THRESHOLD) ? (W.PIECE_VALUE / 3) : W.PIECE_VALUE;
 
@@ -260,71 +979,45 @@ int util_pieces(Game* game, Player player) {
 }
 
 // ÉVALUATION DE LA MOBILITÉ : Plus de mouvements = meilleure position
-int util_mobility(Game* game, Player player) {
-    Move moves[10*16];
-    int mobility_p1 = all_possible_moves(game, moves, P1);
-    int mobility_p2 = all_possible_moves(game, moves, P2);
+// Les coups sont comptés sur les bitboards, sans construire de liste
+int util_mobility(const BitboardPosition *bb, Player player) {
+    int mobility_p1 = bitboard_count_moves(bb, P1);
+    int mobility_p2 = bitboard_count_moves(bb, P2);
 
     return (player == P1) ? (mobility_p1 - mobility_p2) * W.MOBILITY : (mobility_p2 - mobility_p1) * W.MOBILITY;
 }
 
 // CONTRÔLE DU CENTRE : Occuper le centre est avantageux
-int util_center(Game* game, Player player) {
+int util_center(const Game* game, Player player) {
     int score_p1 = 0;
     int score_p2 = 0;
     for (int i = 3; i <= 5; i++) {
         for (int j = 3; j <= 5; j++) {
-                Player piece_owner = get_player(game->board[i][j]);
-                if (piece_owner == P1) score_p1 += W.CENTER;
-                if (piece_owner == P2) score_p2 += W.CENTER;
+                Player owner = piece_owner(game->board[i][j]);
+                if (owner == P1) score_p1 += W.CENTER;
+                if (owner == P2) score_p2 += W.CENTER;
         }
     }
     return (player == P1) ? (score_p1 - score_p2) : (score_p2 - score_p1);
 }
 
 // POSITION AVANCÉE : Avancer vers l'adversaire
-int util_forward(Game* game, Player player) {
+int util_forward(const Game* game, Player player) {
     int score_p1 = 0;
     int score_p2 = 0;
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-                Player piece_owner = get_player(game->board[i][j]);
-                if (piece_owner == P1) {
-                    // P1 veut avancer vers le bas (grandes valeurs de i)
-                    score_p1 += i * 3;
-                }
-                if (piece_owner == P2) {
-                    // P2 veut avancer vers le haut (petites valeurs de i)
-                    score_p2 += (8 - i) * 3;
-                }
+                // P1 veut avancer vers le bas, P2 vers le haut (poids précalculés)
+                Player owner = piece_owner(game->board[i][j]);
+                if (owner == P1) score_p1 += EVAL_FORWARD[0][BB_SQUARE(i, j)];
+                if (owner == P2) score_p2 += EVAL_FORWARD[1][BB_SQUARE(i, j)];
         }
     }
     return (player == P1) ? (score_p1 - score_p2) : (score_p2 - score_p1);
 }
 
-int king_is_threatened(Game* game, Player player) {
-    int dirs[4][2] = {{-1,0},{1,0},{0,-1},{0,1}};
-    Piece king_piece = (player == P1) ? P1_KING : P2_KING;
-
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            if (game->board[i][j] == king_piece) {
-                for (int d = 0; d < 4; d++) {
-                    int ni = i + dirs[d][0];
-                    int nj = j + dirs[d][1];
-                    if (ni >= 0 && ni < GRID_SIZE && nj >= 0 && nj < GRID_SIZE) {
-                        Player p = get_player(game->board[ni][nj]);
-                        if (p != NOT_PLAYER && p != player) return 1;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-}
-
 // Vérifie si le roi du joueur est encore sur le plateau
-int king_is_alive(Game* game, Player player) {
+int king_is_alive(const Game* game, Player player) {
     Piece king = (player == P1) ? P1_KING : P2_KING;
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
@@ -336,37 +1029,33 @@ int king_is_alive(Game* game, Player player) {
 
 // Retourne le niveau de menace du roi et indique s'il est en danger immédiat
 // Si le roi a 2 ou plus d'adversaires adjacents => menace critique (retourne 1)
-int king_threats(Game* game, Player player) {
+int king_threats(const Game* game, Player player) {
     Piece king = (player == P1) ? P1_KING : P2_KING;
-    int dirs[4][2] = {{-1,0},{1,0},{0,-1},{0,1}};
-    int threats = 0;
+    Player opponent = (player == P1) ? P2 : P1;
+    Mailbox mb;
 
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            if (game->board[i][j] == king) {
-                threats = 0;
-                for (int d = 0; d < 4; d++) {
-                    int ni = i + dirs[d][0];
-                    int nj = j + dirs[d][1];
-                    if (ni >= 0 && ni < GRID_SIZE && nj >= 0 && nj < GRID_SIZE) {
-                        Player p = get_player(game->board[ni][nj]);
-                        if (p != NOT_PLAYER && p != player) threats++;
-                    }
-                }
+    mailbox_from_game(&mb, game);
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int col = 0; col < GRID_SIZE; col++) {
+            if (game->board[row][col] == king) {
                 // if (threats >= 2) return 1;
-                return threats;
+                return mailbox_adjacent(&mb, MB_SQUARE(row, col), opponent);
             }
         }
     }
     return 0;
 }
 
+int king_is_threatened(const Game* game, Player player) {
+    return king_threats(game, player) > 0;
+}
+
 // ÉVALUATION DES ROIS : Protection et positionnement stratégique
-int util_kings(Game* game, Player player) {
+int util_kings(const Game* game, Player player) {
     int score_p1 = 0;
     int score_p2 = 0;
-    int piece_p1 = score_player_one(*game);
-    int piece_p2 = score_player_two(*game);
+    int piece_p1 = player_score(game, P1);
+    int piece_p2 = player_score(game, P2);
 
     int threats_p1 = king_threats(game, P1);
     int threats_p2 = king_threats(game, P2);
@@ -407,28 +1096,19 @@ int util_kings(Game* game, Player player) {
 }
 
 // FORMATION TACTIQUE : Bonus pour les pièces qui se protègent mutuellement
-int util_tactics(Game* game, Player player) {
+int util_tactics(const Game* game, Player player) {
     int score_p1 = 0;
     int score_p2 = 0;
+    Mailbox mb;
 
+    mailbox_from_game(&mb, game);
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-            Player piece = get_player(game->board[i][j]);
+            Player piece = piece_owner(game->board[i][j]);
             if (piece != NOT_PLAYER) {
-                int allies_nearby = 0;
-                
-                // Vérification des cases adjacentes pour détecter les alliés
-                for (int di = -1; di <= 1; di++) {
-                    for (int dj = -1; dj <= 1; dj++) {
-                        if (di == 0 && dj == 0) continue; // Ignorer la case actuelle
-                        int ni = i + di, nj = j + dj;
-                        if (ni >= 0 && ni < 9 && nj >= 0 && nj < 9) {
-                            if (get_player(game->board[ni][nj]) == piece) {
-                                allies_nearby++;
-                            }
-                        }
-                    }
-                }
+                // Alliés sur les 8 cases voisines, lues dans le plateau bordé
+                int allies_nearby = mailbox_surrounding(&mb, MB_SQUARE(i, j), piece);
+
                 // Bonus proportionnel au nombre d'alliés adjacents
                 if (piece == P1) score_p1 += allies_nearby * W.TACTICS;
                 if (piece == P2) score_p2 += allies_nearby * W.TACTICS;
@@ -439,28 +1119,21 @@ int util_tactics(Game* game, Player player) {
 }
 
 // ANALYSE DES MENACES : Détection des pièces en danger de capture
-int util_threats(Game* game, Player player) {
+int util_threats(const Game* game, Player player) {
     int score_p1 = 0;
     int score_p2 = 0;
-    int dirs[4][2] = {{-1,0}, {1,0}, {0,-1}, {0,1}};
+    Mailbox mb;
 
+    mailbox_from_game(&mb, game);
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-            Player piece = get_player(game->board[i][j]);
+            Player piece = piece_owner(game->board[i][j]);
             if (piece != NOT_PLAYER) {
                 Player opponent = (piece == P1) ? P2 : P1;
-                int threats = 0;
-
-                // Vérification des menaces directes dans les 4 directions cardinales
-                for (int d = 0; d < 4; d++) {
-                    int ni = i + dirs[d][0];
-                    int nj = j + dirs[d][1];
-                    if (ni >= 0 && ni < 9 && nj >= 0 && nj < 9) {
-                        if (get_player(game->board[ni][nj]) == opponent) {
-                            threats++; // Comptage des adversaires adjacents
-                        }
-                    }
-                }
+
+                // Menaces directes : adversaires dans les 4 directions cardinales
+                int threats = mailbox_adjacent(&mb, MB_SQUARE(i, j), opponent);
+
                 // Malus plus sévère si le roi est menacé
                 // if (piece == P1 && game->board[i][j] == P1_KING) score_p1 += threats * W.KING_THREAT_LIGHT; 
                 if (piece == P1) score_p1 += threats * W.THREATS;
@@ -474,83 +1147,202 @@ int util_threats(Game* game, Player player) {
 }
 
 /**
- * @brief Fonction d'évaluation heuristique de l'état du jeu
+ * @brief Compte les pièces adverses au contact du roi d'un camp connu à la compilation
  * 
- * Cette fonction évalue la qualité d'une position pour un joueur donné.
- * Elle prend en compte plusieurs facteurs stratégiques :
- * - Les conditions de victoire/défaite
- * - Le nombre de pièces de chaque joueur
- * - La mobilité (nombre de mouvements possibles)
- * - Le contrôle du centre du plateau
- * - La position et la sécurité des rois
- * - Les menaces sur les pièces adverses
+ * @param ctx Contexte de recherche
+ * @param side Camp dont le roi est examiné (0 = P1, 1 = P2), constant à chaque appel
+ * @return int Nombre de pièces adverses adjacentes au roi (0 si le roi est absent)
+ */
+SIDE_SPECIALIZED int king_attackers_side(const SearchContext *ctx, int side) {
+    int square = ctx->pos.eval.king[side];
+    if (square < 0) return 0;
+    return bb_popcount(bb_and(BB_ADJACENT[square], ctx->pos.bb.pieces[1 - side]));
+}
+
+/**
+ * @brief Compte les pièces adverses au contact du roi d'un joueur
  * 
- * @param game Pointeur vers la structure de jeu à évaluer
- * @param player Joueur pour lequel effectuer l'évaluation (P1 ou P2)
- * @return int Score d'évaluation (positif = avantageux, négatif = désavantageux)
+ * Équivalent de king_threats() calculé à partir des bitboards, sans
+ * parcourir le plateau.
+ * 
+ * @param ctx Contexte de recherche
+ * @param player Joueur dont le roi est examiné
+ * @return int Nombre de pièces adverses adjacentes au roi (0 si le roi est absent)
+ */
+static int king_attackers(const SearchContext *ctx, Player player) {
+    return (player == P1) ? king_attackers_side(ctx, 0) : king_attackers_side(ctx, 1);
+}
+
+/**
+ * @brief Vainqueur de la position, comme le déterminerait won()
+ * 
+ * @param ctx Contexte de recherche
+ * @return Player P1, P2, DRAW ou NOT_PLAYER si la partie continue
  */
-int utility(Game * game, Player player) {
-    Game temp = *game;
-    won(&temp);
-    Player winner = temp.won;
+static Player eval_winner(const SearchContext *ctx) {
+    const EvalState *eval = &ctx->pos.eval;
+
+    if (ctx->pos.won != NOT_PLAYER) return ctx->pos.won;
+
+    // Roi arrivé dans le coin adverse, puis roi capturé
+    if (eval->king[0] == BB_SQUARE(GRID_SIZE - 1, GRID_SIZE - 1)) return P1;
+    if (eval->king[1] == BB_SQUARE(0, 0)) return P2;
+    if (eval->king[0] < 0) return P2;
+    if (eval->king[1] < 0) return P1;
+
+    // Adversaire réduit à 2 pièces
+    if (eval->pieces[0] <= 2) return P2;
+    if (eval->pieces[1] <= 2) return P1;
+
+    // Victoire au score après 63 tours
+    if (ctx->pos.turn >= 63) {
+        int counter = eval->score[0] - eval->score[1];
+        if (counter == 0) return DRAW;
+        return (counter > 0) ? P1 : P2;
+    }
+    return NOT_PLAYER;
+}
 
-    int piece_p1 = score_player_one(*game);
-    int piece_p2 = score_player_two(*game);
+/**
+ * @brief Évaluation pour un camp connu à la compilation (voir evaluate_window())
+ * 
+ * @param ctx Contexte de recherche contenant la position à évaluer
+ * @param me Camp du joueur évalué (0 = P1, 1 = P2), constant à chaque appel
+ * @param lower Borne inférieure de la fenêtre, pour ce joueur
+ * @param upper Borne supérieure de la fenêtre, pour ce joueur
+ * @return int Score d'évaluation (positif = avantageux, négatif = désavantageux)
+ */
+SIDE_SPECIALIZED int evaluate_window_side(const SearchContext *ctx, int me, int lower, int upper) {
+    const EvalState *eval = &ctx->pos.eval;
+    const int other = 1 - me;
+    const Player player = me ? P2 : P1;
+    const Player opponent = me ? P1 : P2;
 
     // Vérification des conditions de victoire (priorité absolue)
-    if (winner == P1) return (player == P1) ? W.WIN : W.LOSS;
-    if (winner == P2) return (player == P2) ? W.WIN : W.LOSS;
+    Player winner = eval_winner(ctx);
+    if (winner == player) return W.WIN;
+    if (winner == opponent) return W.LOSS;
     if (winner == DRAW) return 0;
 
-    // Vérification si un roi a été capturé
-    if (!king_is_alive(game, P1)) return (player == P1) ? W.LOSS : W.WIN;
-    if (!king_is_alive(game, P2)) return (player == P2) ? W.LOSS : W.WIN;
-
-    // Vérification des bases capturées
-    /* 
-    if (game->board[8][0] == P1_KING || get_player(game->board[8][0]) == P1) {
-        return (player == P2) ? W.LOSS : W.WIN;
-    }
-    if (game->board[0][8] == P2_KING || get_player(game->board[0][8]) == P2) {
-        return (player == P1) ? W.LOSS : W.WIN;
-    } 
-    */
-
     // Vérification des conditions de fin de partie
-    if ((piece_p1 <= 2 && king_is_alive(game, P1)) || (piece_p2 <= 2 && king_is_alive(game, P2)) || game->turn >= 64) {
-        int score_points = piece_p1 - piece_p2;
-        return (player == P1) ? score_points : -score_points;
+    if (eval->score[0] <= 2 || eval->score[1] <= 2 || ctx->pos.turn >= 64) {
+        return eval->score[me] - eval->score[other];
     }
 
-    // Initialisation des scores pour chaque joueur
+    int threats_own = king_attackers_side(ctx, me);
+    int threats_opp = king_attackers_side(ctx, other);
     int score = 0;
 
-    // Calcul des différentes composantes du score
-    // L'ajout de multiples facteurs permet une évaluation plus nuancée
+    // Rois (util_kings) : valeur, bonus de fin de partie et menaces ; seul le
+    // roi du joueur évalué reçoit le bonus, sur le bord de son camp
+    const int home_edge = me ? 8 : 0;
+    int king_own = W.KING_VALUE;
+    if (eval->score[me] <= ENDGAME_PIECE_THRESHOLD &&
+        (eval->king[me] / GRID_SIZE == home_edge || eval->king[me] % GRID_SIZE == home_edge)) {
+        king_own += W.KING_ENDGAME;
+    }
+    if (threats_own == 1) king_own += W.KING_THREAT_LIGHT;
+    else if (threats_own >= 2) king_own += W.KING_THREAT_CRITICAL;
+
+    int king_opp = W.KING_VALUE;
+    if (threats_opp == 1) king_opp += W.KING_THREAT_LIGHT;
+    else if (threats_opp >= 2) king_opp += W.KING_THREAT_CRITICAL;
+
+    score += king_own - king_opp;
+
+    // Avancée (util_forward), matériel (util_pieces), centre et formation
+    score += eval->forward[me] - eval->forward[other];
 
-    // score += util_forward(game, player);
-    score += util_kings(game, player);
-    score += util_forward(game, player);
-    score += util_threats(game, player);
-    score += util_mobility(game, player); 
-    score += util_pieces(game, player); 
-    score += util_center(game, player);
-    score += util_tactics(game, player);
+    int piece_value = (eval->score[0] <= ENDGAME_PIECE_THRESHOLD || eval->score[1] <= ENDGAME_PIECE_THRESHOLD) ? (W.PIECE_VALUE / 3) : W.PIECE_VALUE;
+    score += (eval->score[me] - eval->score[other]) * piece_value;
+    score += (eval->center[me] - eval->center[other]) * W.CENTER;
+    score += (eval->tactics[me] - eval->tactics[other]) * W.TACTICS;
 
     // Vérification si un roi est en danger immédiat
-    int threat_p1 = king_threats(game, P1);
-    int threat_p2 = king_threats(game, P2);
+    score -= (threats_own >= 2) ? W.KING_THREAT_CRITICAL : 0;
+    score += (threats_opp >= 2) ? W.KING_THREAT_CRITICAL : 0;
+
+    // Évaluation paresseuse : la mobilité ne peut plus ramener le score dans la
+    // fenêtre, la borne du score complet de ce côté est retournée
+    int mobility_gain = LAZY_EVAL_PIECE_MOVES * eval->pieces[me] * W.MOBILITY;
+    int mobility_loss = LAZY_EVAL_PIECE_MOVES * eval->pieces[other] * W.MOBILITY;
+    if (score + mobility_gain <= lower) return score + mobility_gain;
+    if (score - mobility_loss >= upper) return score - mobility_loss;
+
+    // Mobilité (util_mobility)
+    int mobility = bitboard_count_moves(&ctx->pos.bb, player) - bitboard_count_moves(&ctx->pos.bb, opponent);
+    return score + mobility * W.MOBILITY;
+}
 
-    if (player == P1) {
-        score -= (threat_p1 >= 2) ? W.KING_THREAT_CRITICAL : 0;
-        score += (threat_p2 >= 2) ? W.KING_THREAT_CRITICAL : 0;
-    } else {
-        score -= (threat_p2 >= 2) ? W.KING_THREAT_CRITICAL : 0;
-        score += (threat_p1 >= 2) ? W.KING_THREAT_CRITICAL : 0;
-    }
- 
+/**
+ * @brief Fonction d'évaluation heuristique de l'état du jeu
+ * 
+ * Cette fonction évalue la qualité d'une position pour un joueur donné.
+ * Elle prend en compte plusieurs facteurs stratégiques :
+ * - Les conditions de victoire/défaite
+ * - Le nombre de pièces de chaque joueur
+ * - La mobilité (nombre de mouvements possibles)
+ * - Le contrôle du centre du plateau
+ * - La position et la sécurité des rois
+ * - Les menaces sur les pièces adverses
+ * 
+ * Le résultat est identique à la somme des fonctions util_*, mais les termes
+ * proviennent de ctx->pos.eval, tenu à jour par update_board_ai() : seule la mobilité
+ * et le voisinage des rois sont calculés ici, à partir des bitboards.
+ * util_threats() n'est pas repris : chaque paire de pièces adverses
+ * adjacentes y compte pour les deux camps, le terme est toujours nul.
+ * 
+ * La mobilité, qui compte les coups des deux camps, est le seul terme
+ * coûteux. Chaque pièce ayant au plus LAZY_EVAL_PIECE_MOVES coups, le terme
+ * est compris entre -LAZY_EVAL_PIECE_MOVES * W.MOBILITY fois les pièces
+ * adverses et LAZY_EVAL_PIECE_MOVES * W.MOBILITY fois les pièces du joueur.
+ * Il n'est calculé que si ces bornes peuvent ramener le score dans la
+ * fenêtre [lower, upper]. Sinon la borne correspondante est retournée : au
+ * plus lower (le score complet ne peut pas la dépasser) ou au moins upper
+ * (il ne peut pas descendre en dessous), comme un échec de la recherche.
+ * 
+ * Le joueur est testé une fois : l'évaluation est menée par la variante de
+ * evaluate_window_side() propre à son camp.
+ * 
+ * @param ctx Contexte de recherche contenant la position à évaluer
+ * @param player Joueur pour lequel effectuer l'évaluation (P1 ou P2)
+ * @param lower Borne inférieure de la fenêtre, pour player
+ * @param upper Borne supérieure de la fenêtre, pour player
+ * @return int Score d'évaluation (positif = avantageux, négatif = désavantageux)
+ */
+static int evaluate_window(const SearchContext *ctx, Player player, int lower, int upper) {
+    if (player == P1) return evaluate_window_side(ctx, 0, lower, upper);
+    return evaluate_window_side(ctx, 1, lower, upper);
+}
+
+/**
+ * @brief Évaluation complète d'une position
+ * 
+ * @param ctx Contexte de recherche contenant la position à évaluer
+ * @param player Joueur pour lequel effectuer l'évaluation (P1 ou P2)
+ * @return int Score d'évaluation (positif = avantageux, négatif = désavantageux)
+ */
+static int evaluate(const SearchContext *ctx, Player player) {
+    return evaluate_window(ctx, player, -SEARCH_INFINITY, SEARCH_INFINITY);
+}
+
+/**
+ * @brief Fonction d'évaluation heuristique de l'état du jeu
+ * 
+ * Point d'entrée public de l'évaluation : construit la représentation
+ * bitboard de la partie puis délègue à evaluate().
+ * 
+ * @param game Pointeur vers la structure de jeu à évaluer
+ * @param player Joueur pour lequel effectuer l'évaluation (P1 ou P2)
+ * @return int Score d'évaluation (positif = avantageux, négatif = désavantageux)
+ */
+int utility(const Game * game, Player player) {
+    SearchContext *ctx = search_context_acquire();
+    if (ctx == NULL) return 0;
 
-    // Calcul du score final relatif au joueur évalué
+    search_context_from_game(ctx, game);
+    int score = evaluate(ctx, player);
+    search_context_release(ctx);
     return score;
 }
 
@@ -567,18 +1359,18 @@ int utility(Game * game, Player player) {
  * @param player Joueur pour lequel générer les mouvements (P1 ou P2)
  * @return int Nombre total de mouvements générés
  */
-int all_possible_moves(Game * game, Move * list, Player player) {
+int all_possible_moves(const Game * game, Move * list, Player player) {
     int size = 0; // Compteur de mouvements générés
     
     // Parcours de toutes les cases du plateau
     for (int i = 0; i < 9; i++) {
         for (int j = 0; j < 9; j++) {
             // Vérification si la case contient une pièce du joueur
-            if (get_player(game->board[i][j]) == player) {
+            if (piece_owner(game->board[i][j]) == player) {
                 
                 // Exploration vers le bas (direction positive i)
                 int k = 1;
-                while ((i + k) < 9 && (get_player(game->board[i + k][j]) == NOT_PLAYER)) {
+                while ((i + k) < 9 && (piece_owner(game->board[i + k][j]) == NOT_PLAYER)) {
                     Move current_move = {i, j, i + k, j, -1};
                     list[size++] = current_move;
                     k++;
@@ -586,7 +1378,7 @@ int all_possible_moves(Game * game, Move * list, Player player) {
 
                 // Exploration vers le haut (direction négative i)
                 k = 1;
-                while ((i - k) >= 0 && (get_player(game->board[i - k][j]) == NOT_PLAYER)) {
+                while ((i - k) >= 0 && (piece_owner(game->board[i - k][j]) == NOT_PLAYER)) {
                     Move current_move = {i, j, i - k, j, -1};
                     list[size++] = current_move;
                     k++;
@@ -594,7 +1386,7 @@ int all_possible_moves(Game * game, Move * list, Player player) {
 
                 // Exploration vers la droite (direction positive j)
                 k = 1;
-                while ((j + k) < 9 && (get_player(game->board[i][j + k]) == NOT_PLAYER)) {
+                while ((j + k) < 9 && (piece_owner(game->board[i][j + k]) == NOT_PLAYER)) {
                     Move current_move = {i, j, i, j + k, -1};
                     list[size++] = current_move;
                     k++;
@@ -602,7 +1394,7 @@ int all_possible_moves(Game * game, Move * list, Player player) {
 
                 // Exploration vers la gauche (direction négative j)
                 k = 1;
-                while ((j - k) >= 0 && (get_player(game->board[i][j - k]) == NOT_PLAYER)) {
+                while ((j - k) >= 0 && (piece_owner(game->board[i][j - k]) == NOT_PLAYER)) {
                     Move current_move = {i, j, i, j - k, -1};
                     list[size++] = current_move;
                     k++;
@@ -615,246 +1407,1873 @@ int all_possible_moves(Game * game, Move * list, Player player) {
 }
 
 /**
- * @brief Fonction de comparaison pour le tri des mouvements
+ * @brief Mémorise un coup calme ayant provoqué une coupure alpha-bêta
  * 
- * Cette fonction compare deux mouvements scorés pour le tri par ordre décroissant.
- * Utilisée par qsort() pour ordonner les mouvements du plus prometteur au moins prometteur.
+ * Le coup devient le premier killer du pli courant, la réponse mémorisée
+ * au coup adverse qui a mené au nœud, et son score d'historique (pour le
+ * camp qui le joue) augmente de depth². Quand un score dépasse HISTORY_MAX,
+ * la table du camp est divisée par deux.
  * 
- * @param a Pointeur vers le premier mouvement scoré
- * @param b Pointeur vers le second mouvement scoré
- * @return int Valeur de comparaison pour le tri décroissant
+ * Un contexte qui aide un nœud partagé lit l'historique et les contre-coups
+ * du propriétaire sans les modifier : seuls ses propres killers changent.
+ * 
+ * @param ctx Contexte de recherche
+ * @param move Coup ayant provoqué la coupure
+ * @param depth Profondeur restante au nœud de la coupure
  */
-int compare_moves_desc(const void *a, const void *b) {
-    ScoredMove *m1 = (ScoredMove*)a;
-    ScoredMove *m2 = (ScoredMove*)b;
-    // Tri par score décroissant : les meilleurs scores en premier
-    return m2->score - m1->score;
+static void record_cutoff(SearchContext *ctx, PackedMove move, int depth) {
+    SearchHeuristics *heuristics = &ctx->own_heuristics;
+    int from = packed_from(move);
+    int to = packed_to(move);
+    int side = ctx->pos.turn & 1;
+
+    if (ctx->ply < SEARCH_MAX_PLY && !packed_same(ctx->stack[ctx->ply].killers[0], move)) {
+        ctx->stack[ctx->ply].killers[1] = ctx->stack[ctx->ply].killers[0];
+        ctx->stack[ctx->ply].killers[0] = move;
+    }
+    if (ctx->heuristics != heuristics) return;
+
+    if (ctx->ply > 0 && ctx->stack[ctx->ply - 1].played != PACKED_MOVE_NONE) {
+        PackedMove previous = ctx->stack[ctx->ply - 1].played;
+        heuristics->countermoves[packed_from(previous)][packed_to(previous)] = move;
+    }
+
+    int *entry = &heuristics->history[side][from][to];
+    *entry += depth * depth;
+    if (*entry > HISTORY_MAX) {
+        for (int i = 0; i < BB_SQUARES; i++) {
+            for (int j = 0; j < BB_SQUARES; j++) heuristics->history[side][i][j] /= 2;
+        }
+    }
 }
 
 /**
- * @brief Génère tous les mouvements possibles pour un joueur et les trie par score
+ * @brief Prépare le sélecteur de coups d'un nœud
  * 
- * Cette fonction génère tous les mouvements légaux pour un joueur donné,
- * évalue chaque mouvement avec une heuristique simple, puis trie les
- * mouvements par ordre de préférence décroissant.
+ * Aucun coup n'est généré : les killers et le contre-coup sont seulement
+ * relevés pour le pli courant.
  * 
- * @param game Pointeur vers la structure de jeu
- * @param move_list Tableau pour stocker les mouvements triés
- * @param player Joueur pour lequel générer les mouvements (P1 ou P2)
- * @return int Nombre de mouvements générés et triés
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur à préparer
+ * @param player Joueur au trait (P1 ou P2)
+ * @param hash_from Case de départ du coup de la table (TT_NO_SQUARE si aucun)
+ * @param hash_to Case d'arrivée du coup de la table
  */
+static void picker_init(const SearchContext *ctx, MovePicker *picker, Player player, int hash_from, int hash_to) {
+    const SearchHeuristics *heuristics = ctx->heuristics;
+
+    picker->size = 0;
+    picker->next = 0;
+    picker->pending_next = 0;
+    picker->pending_size = 0;
+    picker->stage = PICK_HASH;
+    picker->player = player;
+    picker->hash_move = (hash_from != TT_NO_SQUARE) ? packed_move(hash_from, hash_to) : PACKED_MOVE_NONE;
+
+    picker->refutations[0] = PACKED_MOVE_NONE;
+    picker->refutations[1] = PACKED_MOVE_NONE;
+    picker->refutations[2] = PACKED_MOVE_NONE;
+    picker->refutation = 0;
+    if (ctx->ply < SEARCH_MAX_PLY) {
+        picker->refutations[0] = ctx->stack[ctx->ply].killers[0];
+        picker->refutations[1] = ctx->stack[ctx->ply].killers[1];
+    }
+    if (ctx->ply > 0 && ctx->stack[ctx->ply - 1].played != PACKED_MOVE_NONE) {
+        PackedMove previous = ctx->stack[ctx->ply - 1].played;
+        picker->refutations[2] = heuristics->countermoves[packed_from(previous)][packed_to(previous)];
+    }
+}
 
-int all_possible_moves_ordered(Game *game, Move *move_list, Player player) {
-    ScoredMove scored_moves[10*16]; // Tableau des mouvements avec scores
-    int size = 0; // Compteur de mouvements générés
+/**
+ * @brief Vérifie qu'un coup mémorisé (table, killer, contre-coup) est jouable
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param player Joueur au trait
+ * @param move Coup à vérifier
+ * @return int 1 si une pièce du joueur peut faire ce coup, 0 sinon
+ */
+static int picker_is_legal(const SearchContext *ctx, Player player, PackedMove move) {
+    int from = packed_from(move);
+    if (move == PACKED_MOVE_NONE || !bb_test(ctx->pos.bb.pieces[player == P1 ? 0 : 1], from)) return 0;
+    return bb_test(bitboard_piece_moves(&ctx->pos.bb, from), packed_to(move));
+}
 
-    // Directions de mouvement : bas, haut, droite, gauche
-    int dirs[4][2] = {{1,0},{-1,0},{0,1},{0,-1}};
+/**
+ * @brief Indique si un coup a déjà été produit par une étape précédente
+ */
+static int picker_produced(const MovePicker *picker, PackedMove move) {
+    for (int i = 0; i < picker->size; i++) {
+        if (packed_same(picker->moves[i], move)) return 1;
+    }
+    return 0;
+}
 
-    // Parcours de toutes les cases du plateau
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            // Vérification si la case contient une pièce du joueur
-            if (get_player(game->board[i][j]) != player) continue;
+/**
+ * @brief Génère et score les captures et les menaces sur le roi adverse
+ * 
+ * Chaque coup est joué pour compter ses captures (update_board_ai()) et la
+ * menace qu'il crée sur le roi adverse. Un coup qui capture reçoit le
+ * drapeau MOVE_FLAG_CAPTURE.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur
+ */
+static void picker_score_captures(SearchContext *ctx, MovePicker *picker) {
+    Player opponent = (picker->player == P1) ? P2 : P1;
+    int attackers_before = king_attackers(ctx, opponent);
+    int size = bitboard_generate_captures(&ctx->pos.bb, picker->player, picker->pending, 1);
+    UndoInfo *undo = &ctx->stack[ctx->ply].undo;
+
+    picker->pending_next = 0;
+    picker->pending_size = 0;
+    for (int i = 0; i < size; i++) {
+        PackedMove move = picker->pending[i];
+        if (packed_same(move, picker->hash_move)) continue;
+
+        // Aucun coup n'est joué depuis ce pli pendant la sélection : son annulation est libre
+        update_board_ai(&ctx->pos, move, undo);
+        int attackers = king_attackers(ctx, opponent);
+        undo_board_ai(&ctx->pos, undo);
+
+        // Seule une menace créée par le coup compte
+        int score = undo->eaten_count * ORDER_CAPTURE;
+        if (attackers > attackers_before) {
+            score += (attackers >= 2) ? ORDER_KING_CRITICAL : ORDER_KING_LIGHT;
+        }
+        if (score == 0) continue; // Ni capture ni menace : coup calme
+        if (undo->eaten_count > 0) move |= MOVE_FLAG_CAPTURE;
+
+        picker->pending[picker->pending_size] = move;
+        picker->scores[picker->pending_size++] = score;
+    }
+}
 
-            // Exploration des 4 directions possibles
-            for (int d = 0; d < 4; d++) {
-                int k = 1; // Distance de déplacement
-                while (1) {
-                    // Calcul de la nouvelle position
-                    int ni = i + k * dirs[d][0];
-                    int nj = j + k * dirs[d][1];
+/**
+ * @brief Génère les coups calmes et les score par l'historique du camp
+ * 
+ * Les coups déjà produits (table, captures, killers) sont écartés.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur
+ */
+static void picker_score_quiet(SearchContext *ctx, MovePicker *picker) {
+    const int (*history)[BB_SQUARES] = ctx->heuristics->history[picker->player == P1 ? 0 : 1];
+    int size = bitboard_generate_moves(&ctx->pos.bb, picker->player, picker->pending);
 
-                    // Arrêt si hors du plateau
-                    if (ni < 0 || ni >= GRID_SIZE || nj < 0 || nj >= GRID_SIZE) break;
+    picker->pending_next = 0;
+    picker->pending_size = 0;
+    for (int i = 0; i < size; i++) {
+        PackedMove move = picker->pending[i];
+        if (picker_produced(picker, move)) continue;
 
-                    // Arrêt si la case n'est pas vide
-                    if (get_player(game->board[ni][nj]) != NOT_PLAYER) break;
+        picker->pending[picker->pending_size] = move;
+        picker->scores[picker->pending_size++] = history[packed_from(move)][packed_to(move)];
+    }
+}
 
-                    // Création et évaluation du mouvement
-                    Move move = {i, j, ni, nj, -1};
+/**
+ * @brief Retire le coup de meilleur score parmi les coups restants de l'étape
+ * 
+ * Les coups passés gardent leur ordre : à score égal, l'ordre du générateur
+ * est conservé.
+ * 
+ * @param picker Sélecteur dont l'étape a encore des coups
+ * @return PackedMove Coup retiré
+ */
+static PackedMove picker_select(MovePicker *picker) {
+    int best = picker->pending_next;
+    for (int i = best + 1; i < picker->pending_size; i++) {
+        if (picker->scores[i] > picker->scores[best]) best = i;
+    }
 
-                    game->selected_tile[0] = i;
-                    game->selected_tile[1] = j;
-                    UndoInfo undo_info = update_board_ai(game, ni, nj); // Appliquer le mouvement
+    PackedMove move = picker->pending[best];
+    for (int i = best; i > picker->pending_next; i--) {
+        picker->pending[i] = picker->pending[i - 1];
+        picker->scores[i] = picker->scores[i - 1];
+    }
+    picker->pending_next++;
+    return move;
+}
 
-                    /*
-                    Game temp = *game;
-                    // Simulation rapide du mouvement
-                    temp.board[ni][nj] = temp.board[i][j];
-                    // temp.board[i][j] = (get_player(temp.board[i][j]) == P1) ? P1_VISITED : P2_VISITED;
-                    temp.board[i][j] = P_NONE;
-                    */
+/**
+ * @brief Produit le coup suivant, en passant aux étapes suivantes si nécessaire
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur
+ * @return int 1 si un coup a été ajouté à picker->moves, 0 si tous les coups ont été produits
+ */
+static int picker_produce(SearchContext *ctx, MovePicker *picker) {
+    PackedMove move = PACKED_MOVE_NONE;
+
+    while (move == PACKED_MOVE_NONE) {
+        switch (picker->stage) {
+            case PICK_HASH:
+                if (picker_is_legal(ctx, picker->player, picker->hash_move)) move = picker->hash_move;
+                picker->stage = PICK_CAPTURES_GEN;
+                break;
+            case PICK_CAPTURES_GEN:
+                picker_score_captures(ctx, picker);
+                picker->stage = PICK_CAPTURES;
+                break;
+            case PICK_CAPTURES:
+                if (picker->pending_next < picker->pending_size) move = picker_select(picker);
+                else picker->stage = PICK_REFUTATIONS;
+                break;
+            case PICK_REFUTATIONS:
+                if (picker->refutation < 3) {
+                    // Une réfutation qui capture a déjà été produite avec les captures
+                    PackedMove candidate = picker->refutations[picker->refutation++];
+                    if (picker_is_legal(ctx, picker->player, candidate) && !picker_produced(picker, candidate)) move = candidate;
+                } else {
+                    picker->stage = PICK_QUIET_GEN;
+                }
+                break;
+            case PICK_QUIET_GEN:
+                picker_score_quiet(ctx, picker);
+                picker->stage = PICK_QUIET;
+                break;
+            case PICK_QUIET:
+                if (picker->pending_next < picker->pending_size) move = picker_select(picker);
+                else picker->stage = PICK_DONE;
+                break;
+            case PICK_DONE:
+                return 0;
+        }
+    }
 
-                    // Évaluation simple basée sur le score des joueurs
-                    // int score = score_player_two(temp) - score_player_one(temp);
-                    int score = utility(game, player);
+    picker->moves[picker->size++] = move;
+    return 1;
+}
 
-                    if (undo_info.eaten_count > 0) {
-                        score += undo_info.eaten_count * W.PIECE_VALUE; // grosse récompense pour capture
-                    }
+/**
+ * @brief Rend le coup suivant du nœud
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur
+ * @return PackedMove Coup suivant, PACKED_MOVE_NONE quand tous les coups ont été rendus
+ */
+static PackedMove picker_next(SearchContext *ctx, MovePicker *picker) {
+    if (picker->next == picker->size && !picker_produce(ctx, picker)) return PACKED_MOVE_NONE;
+    return picker->moves[picker->next++];
+}
 
-                    // Bonus pour menaces au roi adverse
-                    Player opponent = (player == P1) ? P2 : P1;
-                    if(king_threats(game, opponent)>=2) score += W.KING_VALUE;
+/**
+ * @brief Produit tous les coups restants sans les rendre
+ * 
+ * Utilisé quand la liste complète est nécessaire : coups racine et nœuds
+ * partagés entre threads. picker_next() continue ensuite de rendre les coups
+ * dans le même ordre.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param picker Sélecteur
+ */
+static void picker_fill(SearchContext *ctx, MovePicker *picker) {
+    while (picker_produce(ctx, picker)) {}
+}
 
-                    // Ajout du mouvement au tableau
-                    scored_moves[size].s_move = move;
-                    scored_moves[size].score = score;
-                    size++;
+/**
+ * @brief Génère tous les mouvements possibles pour un joueur et les trie par score
+ * 
+ * Les coups sont produits par le sélecteur par étapes, par priorité
+ * décroissante :
+ * - le meilleur coup de la table de transposition
+ * - les captures et menaces sur le roi adverse, par nombre de captures
+ *   (obtenu en jouant le coup avec update_board_ai()) puis gravité de la menace
+ * - les deux coups killers du pli courant
+ * - la réponse mémorisée au coup adverse précédent (contre-coup)
+ * - les coups calmes, par historique des coupures du camp
+ * 
+ * À score égal, l'ordre du générateur est conservé.
+ * 
+ * @param ctx Contexte de recherche (plateau, bitboards et heuristiques)
+ * @param move_list Tableau pour stocker les mouvements triés (au moins 10*16 éléments)
+ * @param player Joueur pour lequel générer les mouvements (P1 ou P2)
+ * @param hash_from Case de départ du coup de la table (TT_NO_SQUARE si aucun)
+ * @param hash_to Case d'arrivée du coup de la table
+ * @return int Nombre de mouvements générés et triés
+ */
+static int order_moves(SearchContext *ctx, PackedMove *move_list, Player player, int hash_from, int hash_to) {
+    MovePicker *picker = &ctx->stack[ctx->ply].picker;
+    picker_init(ctx, picker, player, hash_from, hash_to);
+    picker_fill(ctx, picker);
+    memcpy(move_list, picker->moves, picker->size * sizeof(PackedMove));
+    return picker->size;
+}
 
-                    undo_board_ai(game, undo_info); // Annuler le mouvement
+/**
+ * @brief Génère tous les mouvements possibles pour un joueur et les trie par score
+ * 
+ * Point d'entrée public : construit le contexte bitboard de la partie puis
+ * délègue à order_moves().
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param move_list Tableau pour stocker les mouvements triés
+ * @param player Joueur pour lequel générer les mouvements (P1 ou P2)
+ * @return int Nombre de mouvements générés et triés
+ */
+int all_possible_moves_ordered(Game *game, Move *move_list, Player player) {
+    SearchContext *ctx = search_context_acquire();
+    if (ctx == NULL) return 0;
 
-                    k++; // Passage à la distance suivante
-                }
-            }
-        }
-    }
+    search_context_from_game(ctx, game);
+    search_context_clear_heuristics(ctx);
 
-    // Tri des mouvements par score décroissant
-    qsort(scored_moves, size, sizeof(ScoredMove), compare_moves_desc);
+    PackedMove *moves = ctx->stack[0].moves;
+    int size = order_moves(ctx, moves, player, TT_NO_SQUARE, TT_NO_SQUARE);
+    for (int i = 0; i < size; i++) move_list[i] = move_unpack(moves[i]);
+    search_context_release(ctx);
+    return size;
+}
 
-    // Copie des mouvements triés dans le tableau de sortie
+/**
+ * @brief Place un coup donné en tête de liste
+ * 
+ * Les coups situés avant lui sont décalés d'un rang ; l'ordre relatif des
+ * autres coups est conservé. Ne fait rien si le coup n'est pas dans la liste.
+ * 
+ * @param list Liste de coups
+ * @param size Nombre de coups dans la liste
+ * @param move Coup à avancer (comparé par ses cases, drapeaux ignorés)
+ */
+static void move_to_front(PackedMove *list, int size, PackedMove move) {
     for (int i = 0; i < size; i++) {
-        move_list[i] = scored_moves[i].s_move;
+        if (packed_same(list[i], move)) {
+            PackedMove found = list[i];
+            for (int j = i; j > 0; j--) list[j] = list[j - 1];
+            list[0] = found;
+            return;
+        }
     }
+}
 
-    return size;
-} 
+/**
+ * @brief Clé de la table de transposition pour la position courante
+ * 
+ * @param ctx Contexte de recherche
+ * @param initial_player Joueur pour lequel les scores sont exprimés
+ * @return uint64_t Clé à utiliser pour tt_probe() et tt_store()
+ */
+static inline uint64_t tt_key(const SearchContext *ctx, Player initial_player) {
+    return (initial_player == P2) ? (ctx->pos.hash ^ TT_PERSPECTIVE_P2) : ctx->pos.hash;
+}
 
 /**
- * @brief Algorithme minimax avec élagage alpha-bêta
+ * @brief Compte un nœud et contrôle périodiquement l'arrêt de la recherche
  * 
- * Implémentation de l'algorithme minimax avec optimisation alpha-bêta pour
- * l'évaluation des mouvements. Cet algorithme explore l'arbre de jeu en
- * alternant entre maximisation et minimisation du score selon le joueur.
+ * L'échéance et les demandes d'arrêt ou d'annulation sont consultées tous
+ * les 1024 nœuds ; une recherche interrompue remonte sans résultat. Un
+ * contexte qui cherche les coups d'un nœud partagé s'arrête aussi dès
+ * qu'une coupure est trouvée à ce nœud ou à un nœud partagé englobant.
  * 
- * @param game Pointeur vers la structure de jeu à évaluer
- * @param depth Profondeur restante de recherche dans l'arbre
- * @param maximizing 1 si le joueur actuel maximise, 0 s'il minimise
- * @param alpha Valeur alpha pour l'élagage (meilleur score pour maximizing)
- * @param beta Valeur beta pour l'élagage (meilleur score pour minimizing)
- * @param initial_player Joueur pour lequel on évalue la position
- * @return int Score de la position évaluée
+ * @param ctx Contexte de recherche
+ * @return int Cause de l'arrêt (SEARCH_ABORT_*), 0 si la recherche continue
  */
-int minimax_alpha_beta(Game * game, int depth, int maximizing, int alpha, int beta, Player initial_player) {
-    // Condition d'arrêt : profondeur atteinte ou jeu terminé
-    if (depth == 0 || game->won != NOT_PLAYER) {
-        return utility(game, initial_player);
+static inline int search_node_aborted(SearchContext *ctx) {
+    if ((++ctx->nodes & 1023) == 0) {
+        if ((ctx->deadline_ms && now_ms() >= ctx->deadline_ms) ||
+            (ctx->stop && atomic_load_explicit(ctx->stop, memory_order_relaxed)) ||
+            (ctx->cancel && atomic_load_explicit(ctx->cancel, memory_order_relaxed))) {
+            ctx->aborted = SEARCH_ABORT_TIME;
+        }
     }
-    
-    // Détermination du joueur actuel
-    // Player current_player = ( (game->turn & 1) == 1) ? P2 : P1;
-    Player current_player = maximizing ? initial_player : (initial_player == P1 ? P2 : P1);
+    if (ctx->split && !ctx->aborted && split_aborted(ctx->split)) ctx->aborted = SEARCH_ABORT_SPLIT;
+    return ctx->aborted;
+}
+
+/**
+ * @brief Signe des scores négamax pour le joueur au trait
+ * 
+ * L'évaluation reste calculée du point de vue du joueur initial, comme dans
+ * la version minimax : elle est simplement négativée quand l'adversaire est
+ * au trait, ce qui laisse l'arbre exploré et les scores inchangés.
+ * 
+ * @param ctx Contexte de recherche
+ * @param initial_player Joueur pour lequel la recherche est menée
+ * @return int 1 si initial_player est au trait, -1 sinon
+ */
+static inline int side_sign(const SearchContext *ctx, Player initial_player) {
+    Player side = ((ctx->pos.turn & 1) == 0) ? P1 : P2;
+    return (side == initial_player) ? 1 : -1;
+}
 
-    // Génération de tous les mouvements possibles pour le joueur actuel
-    Move possible_moves[10 * 16]; // Maximum théorique : 10 pièces × 16 mouvements chacune
-    int size = all_possible_moves_ordered(game, possible_moves, current_player);
+/**
+ * @brief Évaluation statique pour le joueur au trait, paresseuse hors de la fenêtre
+ * 
+ * La fenêtre est convertie du point de vue d'initial_player, pour lequel
+ * l'évaluation est calculée (elle n'est pas antisymétrique).
+ * 
+ * @param ctx Contexte de recherche
+ * @param initial_player Joueur pour lequel la recherche est menée
+ * @param alpha Borne inférieure de la fenêtre, pour le joueur au trait
+ * @param beta Borne supérieure de la fenêtre, pour le joueur au trait
+ * @return int Évaluation pour le joueur au trait
+ */
+static int evaluate_side(const SearchContext *ctx, Player initial_player, int alpha, int beta) {
+    if (side_sign(ctx, initial_player) > 0) return evaluate_window(ctx, initial_player, alpha, beta);
+    return -evaluate_window(ctx, initial_player, -beta, -alpha);
+}
 
-    if (maximizing) {
-        int best_score = -100001; // Initialisation à -∞
-        
-        // Exploration de tous les mouvements possibles
-        for (int i = 0; i < size; i++) {
-            Move current_move = possible_moves[i];
-            
-            // Application du mouvement et sauvegarde pour l'annulation
-            game->selected_tile[0] = current_move.src_row;
-            game->selected_tile[1] = current_move.src_col;
-            UndoInfo undo_info = update_board_ai(game, current_move.dst_row, current_move.dst_col);
+/**
+ * @brief Recherche de quiescence au-delà de la profondeur nominale
+ * 
+ * Une feuille où une capture est possible n'est pas stable : son évaluation
+ * ignore la pièce qui va tomber au coup suivant. La recherche se poursuit
+ * donc avec les seuls coups de capture, produits par
+ * bitboard_generate_captures() sans jouer les autres coups. Au premier pli,
+ * les coups venant au contact du roi adverse sont aussi explorés.
+ * 
+ * Le joueur au trait n'est jamais obligé de capturer : l'évaluation de la
+ * position (stand-pat) sert de borne. Si elle suffit déjà à provoquer une
+ * coupure, aucun coup n'est généré. La profondeur est limitée par
+ * QUIESCENCE_MAX_DEPTH et la table de transposition n'est pas consultée.
+ * 
+ * @param ctx Contexte de recherche
+ * @param qdepth Nombre de plis de quiescence déjà joués
+ * @param alpha Borne inférieure de la fenêtre, pour le joueur au trait
+ * @param beta Borne supérieure de la fenêtre, pour le joueur au trait
+ * @param initial_player Joueur pour lequel la recherche est menée
+ * @return int Score de la position pour le joueur au trait, captures résolues
+ */
+static int search_quiescence(SearchContext *ctx, int qdepth, int alpha, int beta, Player initial_player) {
 
-            // Évaluation récursive du mouvement
-            int current_score = minimax_alpha_beta(game, depth - 1, 0, alpha, beta, initial_player);
-            undo_board_ai(game, undo_info);
+    if (search_node_aborted(ctx)) return 0;
+    ctx->qnodes++;
 
-            // Mise à jour du meilleur score et élagage alpha-bêta
+    int stand_pat = evaluate_side(ctx, initial_player, alpha, beta);
+    if (qdepth >= QUIESCENCE_MAX_DEPTH || eval_winner(ctx) != NOT_PLAYER) return stand_pat;
 
-            // best_score = (current_score >= best_score) ? current_score : best_score;
-            // alpha = (alpha > best_score) ? alpha : best_score;
+    // Stand-pat : le joueur au trait peut refuser toutes les captures
+    if (stand_pat >= beta) return stand_pat;
+    if (stand_pat > alpha) alpha = stand_pat;
 
-            if (current_score > best_score) best_score = current_score;
-            if (current_score > alpha) alpha = current_score;
-            if (beta <= alpha) break; // Élagage
-        }
-        return best_score;
+    Player current_player = ((ctx->pos.turn & 1) == 0) ? P1 : P2;
+    SearchFrame *frame = &ctx->stack[ctx->ply];
+    int size = bitboard_generate_captures(&ctx->pos.bb, current_player, frame->moves, qdepth == 0);
+    int best_score = stand_pat;
 
-    } else {
-        int best_score = 100001; // Initialisation à +∞ 
-        
-        // Exploration de tous les mouvements possibles
-        for (int i = 0; i < size; i++) {
-            Move current_move = possible_moves[i];
-            
-            // Application du mouvement et sauvegarde pour l'annulation
-            game->selected_tile[0] = current_move.src_row;
-            game->selected_tile[1] = current_move.src_col;
-            UndoInfo undo_info = update_board_ai(game, current_move.dst_row, current_move.dst_col);
+    for (int i = 0; i < size; i++) {
+        update_board_ai(&ctx->pos, frame->moves[i], &frame->undo);
 
-            // Évaluation récursive du mouvement
-            int current_score = minimax_alpha_beta(game, depth - 1, 1, alpha, beta, initial_player);
-            undo_board_ai(game, undo_info);
+        ctx->ply++;
+        int current_score = -search_quiescence(ctx, qdepth + 1, -beta, -alpha, initial_player);
+        ctx->ply--;
+        undo_board_ai(&ctx->pos, &frame->undo);
+        if (ctx->aborted) return 0;
 
-            // Mise à jour du meilleur score et élagage alpha-bêta
+        if (current_score > best_score) best_score = current_score;
+        if (best_score > alpha) alpha = best_score;
+        if (alpha >= beta) break; // Élagage
+    }
 
-            // best_score = (current_score <= best_score) ? current_score : best_score;
-            // beta = (beta < best_score) ? beta : best_score;
+    return best_score;
+}
 
-            if (current_score < best_score) best_score = current_score;
-            if (current_score < beta) beta = current_score;
-            if (beta <= alpha) break; // Élagage
-        }
-        return best_score;
+/**
+ * @brief Ajoute un coup en tête de la variation principale du pli courant
+ * 
+ * La variation du pli est le coup suivi de celle du pli suivant, que le nœud
+ * enfant vient de construire (table triangulaire).
+ * 
+ * @param ctx Contexte de recherche
+ * @param move Coup qui a amélioré alpha au pli courant
+ */
+static inline void pv_update(SearchContext *ctx, PackedMove move) {
+    int ply = ctx->ply;
+    SearchFrame *frame = &ctx->stack[ply];
+    const SearchFrame *child = &ctx->stack[ply + 1];
+
+    frame->pv[ply] = move;
+    for (int next = ply + 1; next < child->pv_length; next++) {
+        frame->pv[next] = child->pv[next];
     }
+    frame->pv_length = (child->pv_length > ply + 1) ? child->pv_length : ply + 1;
 }
 
 /**
- * @brief Trouve le meilleur mouvement en utilisant l'algorithme minimax avec élagage alpha-bêta
+ * @brief Indique si le coup nul peut être essayé au nœud courant
  * 
- * Cette fonction est le point d'entrée principal de l'IA. Elle génère tous les
- * mouvements possibles, les évalue en utilisant l'algorithme minimax, et retourne
- * le mouvement avec le meilleur score.
+ * Passer son tour n'est pas un coup légal : l'hypothèse qu'il existe
+ * toujours un coup au moins aussi bon tombe en fin de partie, quand chaque
+ * camp n'a plus que quelques pièces, et près de l'horizon du tour 63 où le
+ * décompte des tours décide du vainqueur. Deux coups nuls ne se suivent pas.
  * 
- * @param game Pointeur vers la structure de jeu
- * @param depth Profondeur maximale de recherche dans l'arbre de jeu
- * @return Move Le meilleur mouvement trouvé par l'algorithme
+ * @param ctx Contexte de recherche
+ * @param depth Profondeur restante
+ * @return int 1 si le coup nul est permis, 0 sinon
  */
-Move minimax_best_move(Game* game, int depth) {
-    // Détermination du joueur actuel
-    Player current_player = ( (game->turn & 1) == 0) ? P1 : P2;
+static int null_move_allowed(const SearchContext *ctx, int depth) {
+    if (depth < NULL_MOVE_MIN_DEPTH) return 0;
+    if (ctx->ply > 0 && ctx->stack[ctx->ply - 1].played == PACKED_MOVE_NONE) return 0;
+    if (ctx->pos.eval.pieces[0] <= ENDGAME_PIECE_THRESHOLD || ctx->pos.eval.pieces[1] <= ENDGAME_PIECE_THRESHOLD) return 0;
+    return ctx->pos.turn + depth < SCORE_HORIZON_TURN;
+}
 
-    // Génération et tri des mouvements possibles
-    Move possible_moves[10 * 16]; // Capacité maximale théorique
-    int size = all_possible_moves_ordered(game, possible_moves, current_player);
-    
-    // Initialisation des variables de recherche
-    int best_score = -100001; // Score initial très bas
-    Move best_move = {-1, -1, -1, -1, -10001}; // Mouvement par défaut invalide
+static int search_negamax(SearchContext *ctx, int depth, int alpha, int beta, Player initial_player);
 
-    // Évaluation de chaque mouvement possible
-    for (int i = 0; i < size; i++) {
-        Move current_move = possible_moves[i];
+/**
+ * @brief Joue et cherche un coup d'un nœud de search_negamax()
+ * 
+ * Le premier coup est cherché avec la fenêtre complète, les suivants avec
+ * une fenêtre nulle, recherchés avec la fenêtre complète s'ils dépassent
+ * alpha. Les coups calmes tardifs sont d'abord cherchés un ou deux plis
+ * moins profond ; près des feuilles, les coups calmes sans menace sont
+ * élagués si node->futile est positionné.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param node Paramètres du nœud
+ * @param index Rang du coup dans node->moves
+ * @param alpha Borne inférieure de la fenêtre, pour le joueur au trait
+ * @param eaten Nombre de pièces capturées par le coup (sortie)
+ * @return int Score du coup pour le joueur au trait, -SEARCH_INFINITY si le coup est élagué
+ */
+static int search_move(SearchContext *ctx, const SearchNode *node, int index, int alpha, int *eaten) {
+    PackedMove move = node->moves[index];
+    int depth = node->depth;
+    int beta = node->beta;
+    Player initial_player = node->initial_player;
+    SearchFrame *frame = &ctx->stack[ctx->ply];
+
+    // Application du mouvement et sauvegarde pour l'annulation
+    update_board_ai(&ctx->pos, move, &frame->undo);
+    *eaten = frame->undo.eaten_count;
+
+    // Les captures, les coups de roi et les menaces sur le roi adverse ne sont jamais élagués
+    if (node->futile && index > 0 && frame->undo.eaten_count == 0 &&
+        !piece_is_king(frame->undo.src_piece) &&
+        king_attackers(ctx, node->opponent) <= node->attackers_before) {
+        undo_board_ai(&ctx->pos, &frame->undo);
+        return -SEARCH_INFINITY;
+    }
 
-        // Application du mouvement et sauvegarde de l'état
-        game->selected_tile[0] = current_move.src_row;
-        game->selected_tile[1] = current_move.src_col;
-        UndoInfo undo_info = update_board_ai(game, current_move.dst_row, current_move.dst_col);
+    // Fenêtre complète pour le premier coup, fenêtre nulle pour les suivants ;
+    // les coups calmes tardifs sont d'abord cherchés moins profond
+    int reduction = 0;
+    if (depth >= LMR_MIN_DEPTH && index >= LMR_FULL_MOVES && frame->undo.eaten_count == 0) {
+        reduction = (index >= LMR_DEEP_MOVES && depth > LMR_MIN_DEPTH) ? 2 : 1;
+    }
+
+    frame->played = move;
+    ctx->ply++;
+    int score;
+    if (index == 0) {
+        score = -search_negamax(ctx, depth - 1, -beta, -alpha, initial_player);
+    } else {
+        score = -search_negamax(ctx, depth - 1 - reduction, -alpha - 1, -alpha, initial_player);
+        if (reduction > 0 && score > alpha) {
+            score = -search_negamax(ctx, depth - 1, -alpha - 1, -alpha, initial_player);
+        }
+        if (score > alpha && score < beta) {
+            score = -search_negamax(ctx, depth - 1, -beta, -alpha, initial_player);
+        }
+    }
+    ctx->ply--;
+    undo_board_ai(&ctx->pos, &frame->undo);
 
-        // Évaluation du mouvement avec minimax
-        int current_score = minimax_alpha_beta(game, depth, 1, -100000, 100000, current_player);
-        undo_board_ai(game, undo_info);
+    return score;
+}
 
-        // Mise à jour du meilleur mouvement si nécessaire
-        if (current_score > best_score) {
-            best_move = possible_moves[i];
-            best_score = current_score;
+/**
+ * @brief Cherche les coups d'un nœud partagé jusqu'à épuisement ou coupure
+ * 
+ * Chaque coup est réservé par incrément atomique de split->next : le
+ * propriétaire du nœud et les threads venus l'aider se répartissent ainsi
+ * les coups sans les chercher deux fois.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param split Nœud partagé
+ */
+static void split_search_moves(SearchContext *ctx, SplitPoint *split) {
+    int index;
+    while (!atomic_load(&split->aborted) && (index = atomic_fetch_add(&split->next, 1)) < split->node.size) {
+        int eaten;
+        int score = search_move(ctx, &split->node, index, split->alpha, &eaten);
+        if (ctx->aborted) {
+            if (ctx->aborted == SEARCH_ABORT_TIME) atomic_store(&split->stopped, 1);
+            break;
         }
+
+        pthread_mutex_lock(&split->lock);
+        if (score > split->best_score) {
+            split->best_score = score;
+            split->best_index = index;
+            split->best_quiet = (eaten == 0);
+        }
+        pthread_mutex_unlock(&split->lock);
+
+        // Fenêtre nulle : dépasser alpha, c'est provoquer la coupure
+        if (score > split->alpha) atomic_store(&split->aborted, 1);
     }
+}
+
+/**
+ * @brief Vole la plus ancienne tâche de la file d'un autre thread
+ * 
+ * @param pool Threads de la recherche
+ * @param thief Numéro du thread voleur
+ * @param ancestor Si non NULL, seules les tâches des nœuds partagés sous ce nœud sont acceptées
+ * @return SplitPoint* Nœud partagé à aider, NULL si aucune tâche disponible
+ */
+static SplitPoint *pool_steal(SearchPool *pool, int thief, const SplitPoint *ancestor) {
+    for (int offset = 1; offset < pool->thread_count; offset++) {
+        TaskDeque *deque = &pool->deques[(thief + offset) % pool->thread_count];
+        SplitPoint *task = NULL;
+
+        pthread_mutex_lock(&deque->lock);
+        if (deque->top < deque->bottom) {
+            task = deque->tasks[deque->top];
+            if (ancestor) {
+                const SplitPoint *parent = task->parent;
+                while (parent && parent != ancestor) parent = parent->parent;
+                if (!parent) task = NULL;
+            }
+            if (task && ++deque->top == deque->bottom) deque->top = deque->bottom = 0;
+        }
+        pthread_mutex_unlock(&deque->lock);
+
+        if (task) return task;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Place un contexte de niveau split->level + 1 sur un nœud partagé
+ * 
+ * La position, les coups menant au nœud et les killers des plis suivants
+ * sont recopiés depuis le contexte figé du propriétaire ; l'historique et
+ * les contre-coups y sont lus par pointeur. Les compteurs du contexte
+ * s'accumulent d'une tâche à l'autre.
+ * 
+ * @param ctx Contexte du thread au niveau suivant celui du nœud
+ * @param split Nœud partagé
+ */
+static void split_join(SearchContext *ctx, SplitPoint *split) {
+    const SearchContext *owner = split->owner;
+
+    ctx->pos = owner->pos;
+    ctx->aborted = 0;
+    ctx->split = split;
+    ctx->ply = owner->ply;
+    ctx->heuristics = owner->heuristics;
+    for (int ply = 0; ply < owner->ply; ply++) ctx->stack[ply].played = owner->stack[ply].played;
+    for (int ply = owner->ply + 1; ply < SEARCH_MAX_PLY; ply++) {
+        ctx->stack[ply].killers[0] = owner->stack[ply].killers[0];
+        ctx->stack[ply].killers[1] = owner->stack[ply].killers[1];
+    }
+}
+
+/**
+ * @brief Aide un nœud partagé volé dans la file d'un autre thread
+ * 
+ * Les coups sont cherchés dans le contexte du thread de niveau
+ * split->level + 1, préparé par search_pool_init() : ni verrou ni
+ * allocation. Sans contexte de ce niveau, la tâche est rendue et les
+ * coups restent au propriétaire.
+ * 
+ * @param thread Contexte du thread qui aide (n'importe quel niveau)
+ * @param split Nœud partagé à aider
+ */
+static void split_help(SearchContext *thread, SplitPoint *split) {
+    SearchPool *pool = thread->pool;
+    int level = split->level + 1;
+
+    if (level < pool->levels) {
+        SearchContext *ctx = pool->contexts[thread->thread_id][level];
+        split_join(ctx, split);
+        split_search_moves(ctx, split);
+    }
+    atomic_fetch_sub(&split->tasks, 1);
+}
+
+/**
+ * @brief Partage les coups restants d'un nœud avec les threads inactifs (Young Brothers Wait)
+ * 
+ * Appelée une fois le premier coup cherché sans coupure. Une tâche par
+ * thread susceptible d'aider est publiée dans la file du thread courant,
+ * qui cherche lui-même les coups restants dans son contexte du niveau
+ * suivant. Il retire ensuite les tâches non volées puis, en attendant la
+ * fin des autres threads, aide les nœuds partagés créés sous le sien.
+ * 
+ * @param ctx Contexte de recherche, dans la position du nœud
+ * @param node Paramètres du nœud (fenêtre nulle)
+ * @param first Rang du premier coup à partager
+ * @param alpha Borne inférieure de la fenêtre
+ * @param best_score Meilleur score du nœud (entrée et sortie)
+ * @param best_index Rang du coup correspondant (entrée et sortie)
+ * @return int 1 si un coup calme a provoqué la coupure, 0 sinon
+ */
+static int search_split(SearchContext *ctx, const SearchNode *node, int first, int alpha, int *best_score, int *best_index) {
+    SearchPool *pool = ctx->pool;
+    TaskDeque *own = &pool->deques[ctx->thread_id];
+    SplitPoint split;
+
+    split.node = *node;
+    split.alpha = alpha;
+    split.owner = ctx;
+    split.parent = ctx->split;
+    split.level = ctx->level;
+    atomic_init(&split.next, first);
+    atomic_init(&split.aborted, 0);
+    atomic_init(&split.stopped, 0);
+    atomic_init(&split.tasks, 0);
+    pthread_mutex_init(&split.lock, NULL);
+    split.best_score = *best_score;
+    split.best_index = *best_index;
+    split.best_quiet = 0;
+
+    // Publication d'une tâche par thread susceptible d'aider
+    int helpers = node->size - first - 1;
+    if (helpers > pool->thread_count - 1) helpers = pool->thread_count - 1;
+    pthread_mutex_lock(&own->lock);
+    for (int i = 0; i < helpers && own->bottom < YBW_DEQUE_SIZE; i++) {
+        own->tasks[own->bottom++] = &split;
+        atomic_fetch_add(&split.tasks, 1);
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    SearchContext *helper = pool->contexts[ctx->thread_id][ctx->level + 1];
+    split_join(helper, &split);
+    split_search_moves(helper, &split);
+    if (helper->aborted) atomic_store(&split.aborted, 1);
+
+    // Retrait des tâches non volées, toujours au bas de la file
+    pthread_mutex_lock(&own->lock);
+    while (own->bottom > own->top && own->tasks[own->bottom - 1] == &split) {
+        own->bottom--;
+        atomic_fetch_sub(&split.tasks, 1);
+    }
+    if (own->top == own->bottom) own->top = own->bottom = 0;
+    pthread_mutex_unlock(&own->lock);
+
+    // Attente des autres threads, en aidant les nœuds partagés qu'ils ont créés
+    while (atomic_load(&split.tasks) > 0) {
+        SplitPoint *task = pool_steal(pool, ctx->thread_id, &split);
+        if (task) split_help(ctx, task);
+        else sched_yield();
+    }
+
+    // Coup interrompu : le résultat est incomplet et le nœud remonte sans résultat
+    if (atomic_load(&split.stopped)) ctx->aborted = SEARCH_ABORT_TIME;
+    else if (split_aborted(split.parent)) ctx->aborted = SEARCH_ABORT_SPLIT;
+    pthread_mutex_destroy(&split.lock);
+
+    *best_score = split.best_score;
+    *best_index = split.best_index;
+    return split.best_score > alpha && split.best_quiet;
+}
+
+/**
+ * @brief Recherche négamax avec Principal Variation Search
+ * 
+ * Les scores sont exprimés pour le joueur au trait et la fenêtre est
+ * négativée à chaque pli : une seule boucle remplace les branches
+ * maximisante et minimisante de minimax.
+ * 
+ * Le premier coup, supposé le meilleur grâce au tri, est cherché avec la
+ * fenêtre complète. Les suivants le sont avec une fenêtre nulle
+ * (alpha, alpha + 1), qui ne sert qu'à prouver qu'ils ne font pas mieux ;
+ * un coup qui dépasse alpha est recherché avec la fenêtre complète. Les
+ * nœuds dont la fenêtre n'est pas nulle (nœuds PV) construisent la variation
+ * principale dans la pile de recherche (SearchFrame.pv) et ne sont pas coupés par la
+ * table de transposition, afin que la variation reste complète.
+ * 
+ * Chaque nœud consulte la table de transposition avant de générer ses coups :
+ * une entrée assez profonde peut fournir directement le score, et son
+ * meilleur coup est essayé en premier. Le résultat est ensuite enregistré
+ * avec sa nature (exact, borne inférieure ou supérieure). Un coup calme
+ * provoquant une coupure alimente les killers et l'historique utilisés par
+ * order_moves() ; l'évaluation complète n'est calculée qu'aux feuilles,
+ * après résolution des captures par search_quiescence().
+ * 
+ * Hors nœuds PV, le coup nul (passer son tour) est d'abord cherché à
+ * profondeur réduite : s'il dépasse déjà beta, le nœud est coupé sans
+ * générer ses coups. Les coups calmes classés au-delà des LMR_FULL_MOVES
+ * premiers sont cherchés un ou deux plis moins profond, puis à pleine
+ * profondeur s'ils dépassent alpha. À FRONTIER_DEPTH plis ou moins des
+ * feuilles, une évaluation statique très inférieure à alpha renvoie
+ * directement à la quiescence (rasoir) ou fait sauter les coups calmes
+ * (futilité).
+ * 
+ * Dans une recherche parallèle (ctx->pool), les coups restants d'un nœud à
+ * fenêtre nulle assez profond sont partagés avec les threads inactifs une
+ * fois le premier coup cherché (search_split()).
+ * 
+ * @param ctx Contexte de recherche (plateau, bitboards et clé Zobrist)
+ * @param depth Profondeur restante de recherche dans l'arbre
+ * @param alpha Borne inférieure de la fenêtre, pour le joueur au trait
+ * @param beta Borne supérieure de la fenêtre, pour le joueur au trait
+ * @param initial_player Joueur pour lequel la recherche est menée
+ * @return int Score de la position pour le joueur au trait
+ */
+static int search_negamax(SearchContext *ctx, int depth, int alpha, int beta, Player initial_player) {
+    int pv_node = (beta - alpha > 1);
+
+    ctx->stack[ctx->ply].pv_length = ctx->ply;
+    if (search_node_aborted(ctx)) return 0;
+
+    // Jeu terminé : évaluation directe
+    if (ctx->pos.won != NOT_PLAYER) {
+        return side_sign(ctx, initial_player) * evaluate(ctx, initial_player);
+    }
+
+    // Profondeur atteinte : la position n'est évaluée qu'une fois calme
+    if (depth == 0) {
+        return search_quiescence(ctx, 0, alpha, beta, initial_player);
+    }
+
+    // Consultation de la table de transposition
+    uint64_t key = tt_key(ctx, initial_player);
+    int alpha_orig = alpha;
+    TTEntry entry;
+    int has_entry = tt_probe(key, &entry);
+
+    if (has_entry && !pv_node && entry.depth >= depth) {
+        TTBound bound = tt_entry_bound(&entry);
+        if (bound == TT_EXACT) return entry.score;
+        if (bound == TT_LOWER && entry.score >= beta) return entry.score;
+        if (bound == TT_UPPER && entry.score <= alpha) return entry.score;
+    }
+
+    // Évaluation statique, utilisée par les élagages hors nœuds PV
+    int static_eval = 0;
+    if (!pv_node) {
+        static_eval = evaluate_side(ctx, initial_player, alpha - RAZOR_MARGIN * FRONTIER_DEPTH, beta);
+    }
+
+    // Rasoir : loin sous alpha près des feuilles, seules les captures peuvent remonter le score
+    if (!pv_node && depth <= FRONTIER_DEPTH && static_eval + RAZOR_MARGIN * depth <= alpha) {
+        int razor_score = search_quiescence(ctx, 0, alpha, alpha + 1, initial_player);
+        if (ctx->aborted) return 0;
+        if (depth == 1 || razor_score <= alpha) return razor_score;
+    }
+
+    // Coup nul : si passer son tour suffit à dépasser beta, le nœud est coupé
+    if (!pv_node && null_move_allowed(ctx, depth) && static_eval >= beta) {
+        ctx->pos.turn++;
+        ctx->pos.hash ^= ZOBRIST_SIDE;
+        ctx->stack[ctx->ply].played = PACKED_MOVE_NONE;
+        ctx->ply++;
+        int null_score = -search_negamax(ctx, depth - 1 - NULL_MOVE_REDUCTION, -beta, -beta + 1, initial_player);
+        ctx->ply--;
+        ctx->pos.turn--;
+        ctx->pos.hash ^= ZOBRIST_SIDE;
+        if (ctx->aborted) return 0;
+
+        // Une victoire obtenue en passant n'est pas prouvée
+        if (null_score >= beta) return (null_score >= W.WIN) ? beta : null_score;
+    }
+
+    // Coups du joueur au trait produits par étapes, le meilleur coup connu
+    // de cette position en premier : une coupure précoce évite de générer le reste
+    Player current_player = ((ctx->pos.turn & 1) == 0) ? P1 : P2;
+    MovePicker *picker = &ctx->stack[ctx->ply].picker;
+    int hash_from = has_entry ? entry.best_from : TT_NO_SQUARE;
+    int hash_to = has_entry ? entry.best_to : TT_NO_SQUARE;
+    picker_init(ctx, picker, current_player, hash_from, hash_to);
+    PackedMove *possible_moves = picker->moves;
+
+    // Futilité : un coup calme ne peut pas combler l'écart avec alpha
+    SearchNode node;
+    node.moves = possible_moves;
+    node.size = 0; // Connu seulement une fois tous les coups produits
+    node.depth = depth;
+    node.beta = beta;
+    node.initial_player = initial_player;
+    node.opponent = (current_player == P1) ? P2 : P1;
+    node.futile = !pv_node && depth <= FRONTIER_DEPTH && static_eval + FUTILITY_MARGIN * depth <= alpha;
+    node.attackers_before = node.futile ? king_attackers(ctx, node.opponent) : 0;
+
+    int best_score = -SEARCH_INFINITY;
+    int best_index = -1;
+
+    for (int i = 0; picker_next(ctx, picker) != PACKED_MOVE_NONE; i++) {
+        if (i == 0) ctx->expanded++;
+
+        // Young Brothers Wait : l'aîné cherché sans coupure, ses frères sont
+        // partagés, ce qui demande la liste complète des coups
+        if (i == 1 && ctx->pool && !pv_node && depth >= YBW_MIN_SPLIT_DEPTH &&
+            ctx->level + 1 < ctx->pool->levels) {
+            picker_fill(ctx, picker);
+            node.size = picker->size;
+            if (node.size > 2) {
+                int quiet_cutoff = search_split(ctx, &node, i, alpha, &best_score, &best_index);
+                if (ctx->aborted) return 0;
+                if (best_score > alpha) {
+                    if (quiet_cutoff) record_cutoff(ctx, possible_moves[best_index], depth);
+                    ctx->cutoffs++;
+                }
+                break;
+            }
+        }
+
+        int eaten;
+        int current_score = search_move(ctx, &node, i, alpha, &eaten);
+        if (ctx->aborted) return 0;
+
+        // Mise à jour du meilleur score et élagage alpha-bêta
+        if (current_score > best_score) {
+            best_score = current_score;
+            best_index = i;
+        }
+        if (current_score > alpha) {
+            alpha = current_score;
+            pv_update(ctx, possible_moves[i]);
+        }
+        if (alpha >= beta) {
+            if (eaten == 0) record_cutoff(ctx, possible_moves[i], depth);
+            ctx->cutoffs++;
+            if (i == 0) ctx->first_cutoffs++;
+            break; // Élagage
+        }
+    }
+
+    // Enregistrement du résultat avec la nature de la borne
+    TTBound bound = TT_EXACT;
+    if (best_score <= alpha_orig) bound = TT_UPPER;
+    else if (best_score >= beta) bound = TT_LOWER;
+
+    int best_from = TT_NO_SQUARE;
+    int best_to = TT_NO_SQUARE;
+    if (best_index >= 0) {
+        best_from = packed_from(possible_moves[best_index]);
+        best_to = packed_to(possible_moves[best_index]);
+    }
+    tt_store(key, depth, best_score, bound, best_from, best_to);
+
+    return best_score;
+}
+
+/**
+ * @brief Algorithme minimax avec élagage alpha-bêta
+ * 
+ * Point d'entrée public : construit le contexte bitboard de la partie puis
+ * délègue à search_negamax(). Le score négamax du joueur au trait est
+ * converti du point de vue d'initial_player, comme le retournait minimax.
+ * 
+ * @param game Pointeur vers la structure de jeu à évaluer
+ * @param depth Profondeur restante de recherche dans l'arbre
+ * @param maximizing 1 si le joueur au trait est initial_player, 0 sinon
+ * @param alpha Valeur alpha pour l'élagage (meilleur score pour maximizing)
+ * @param beta Valeur beta pour l'élagage (meilleur score pour minimizing)
+ * @param initial_player Joueur pour lequel on évalue la position
+ * @return int Score de la position évaluée
+ */
+int minimax_alpha_beta(Game * game, int depth, int maximizing, int alpha, int beta, Player initial_player) {
+    SearchContext *ctx = search_context_acquire();
+    if (ctx == NULL) {
+        LOG_ERROR_MSG("[IA] Allocation du contexte de recherche impossible");
+        return 0;
+    }
+
+    search_context_from_game(ctx, game);
+    search_context_clear_heuristics(ctx);
+    int score = maximizing ? search_negamax(ctx, depth, alpha, beta, initial_player)
+                           : -search_negamax(ctx, depth, -beta, -alpha, initial_player);
+    search_context_release(ctx);
+    return score;
+}
+
+/**
+ * @brief Recherche à la racine pour une profondeur et une fenêtre données
+ * 
+ * Chaque coup racine est joué puis évalué par search_negamax(), selon le même
+ * schéma PVS que dans l'arbre : fenêtre complète pour le premier coup, fenêtre
+ * nulle puis recherche complète si nécessaire pour les suivants. La variation
+ * principale trouvée est laissée dans ctx->stack[0].pv.
+ * 
+ * Avec une fenêtre d'aspiration, un score inférieur ou égal à alpha n'est
+ * qu'une borne supérieure (échec bas) et un score supérieur ou égal à beta
+ * une borne inférieure (échec haut) : l'appelant doit alors relancer la
+ * recherche avec une fenêtre élargie.
+ * 
+ * @param ctx Contexte de recherche
+ * @param root_moves Coups racine, dans l'ordre d'exploration
+ * @param size Nombre de coups racine
+ * @param depth Profondeur restante après le coup racine
+ * @param alpha Borne inférieure de la fenêtre
+ * @param beta Borne supérieure de la fenêtre
+ * @param player Joueur au trait à la racine
+ * @param best_move Meilleur coup trouvé (non modifié si aucun coup)
+ * @return int Score du meilleur coup, -SEARCH_INFINITY si aucun coup n'a été évalué
+ */
+static int search_root(SearchContext *ctx, PackedMove *root_moves, int size, int depth, int alpha, int beta, Player player, PackedMove *best_move) {
+    int best_score = -SEARCH_INFINITY;
+    SearchFrame *frame = &ctx->stack[0];
+    frame->pv_length = 0;
+
+    for (int i = 0; i < size; i++) {
+        PackedMove current_move = root_moves[i];
+
+        // Application du mouvement et sauvegarde de l'état
+        update_board_ai(&ctx->pos, current_move, &frame->undo);
+
+        // C'est à l'adversaire de jouer : son score est négativé
+        frame->played = current_move;
+        ctx->ply++;
+        int current_score;
+        if (i == 0) {
+            current_score = -search_negamax(ctx, depth, -beta, -alpha, player);
+        } else {
+            current_score = -search_negamax(ctx, depth, -alpha - 1, -alpha, player);
+            if (current_score > alpha && current_score < beta) {
+                current_score = -search_negamax(ctx, depth, -beta, -alpha, player);
+            }
+        }
+        ctx->ply--;
+        undo_board_ai(&ctx->pos, &frame->undo);
+        if (ctx->aborted) break;
+
+        // Mise à jour du meilleur mouvement si nécessaire
+        if (current_score > best_score) {
+            *best_move = current_move;
+            best_score = current_score;
+        }
+        if (current_score > alpha) {
+            alpha = current_score;
+            pv_update(ctx, current_move);
+        }
+        if (alpha >= beta) break; // Échec haut de la fenêtre d'aspiration
+    }
+
+    return best_score;
+}
+
+/**
+ * @brief Joue un coup du camp side sur les seuls bitboards, pour perft
+ * 
+ * Même effet sur les plans que make_move_side() : la pièce quitte sa case en
+ * y laissant une case visitée de son camp, efface toute marque de visite à
+ * l'arrivée, et les captures de captures_side() vident leurs cases. Ni la
+ * clé Zobrist ni les termes de l'évaluation ne sont tenus : perft joue sur
+ * une copie de la position et n'a rien à annuler.
+ * 
+ * @param bb Plateau à modifier, side au trait
+ * @param move Mouvement à appliquer
+ * @param side Camp au trait (0 = P1, 1 = P2), constant à chaque appel
+ */
+SIDE_SPECIALIZED void perft_play_side(BitboardPosition *bb, PackedMove move, int side) {
+    int from = packed_from(move);
+    int to = packed_to(move);
+    Bitboard from_bb = bb_square(from);
+    Bitboard to_bb = bb_square(to);
+
+    // Déplacement de la pièce, roi compris
+    bb->pieces[side] = bb_or(bb_andnot(bb->pieces[side], from_bb), to_bb);
+    if (bb_test(bb->kings, from)) bb->kings = bb_or(bb_andnot(bb->kings, from_bb), to_bb);
+    bb->visited[0] = bb_andnot(bb->visited[0], to_bb);
+    bb->visited[1] = bb_andnot(bb->visited[1], to_bb);
+    bb->visited[side] = bb_or(bb->visited[side], from_bb);
+
+    // Direction du mouvement pour les captures
+    Direction direction;
+    if (to / GRID_SIZE != from / GRID_SIZE) {
+        direction = (to < from) ? DIR_TOP : DIR_DOWN;
+    } else {
+        direction = (to < from) ? DIR_LEFT : DIR_RIGHT;
+    }
+
+    // Captures : toutes trouvées avant d'en retirer une
+    int captured[4];
+    int count = captures_side(bb, to, direction, side, captured);
+    for (int i = 0; i < count; i++) {
+        bb_clear(&bb->pieces[1 - side], captured[i]);
+        bb_clear(&bb->kings, captured[i]);
+    }
+}
+
+/**
+ * @brief Compte les feuilles de l'arbre des coups sur les seuls bitboards
+ * 
+ * @param bb Plateau
+ * @param depth Profondeur restante (au moins 1)
+ * @param side Camp au trait (0 = P1, 1 = P2)
+ * @return unsigned long long Nombre de positions atteintes à la profondeur 0
+ */
+static unsigned long long perft_bitboards(const BitboardPosition *bb, int depth, int side) {
+    Player player = side ? P2 : P1;
+
+    // Dernier pli : les coups sont comptés sans être générés ni joués
+    if (depth == 1) return (unsigned long long)bitboard_count_moves(bb, player);
+
+    PackedMove moves[10 * 16];
+    int size = bitboard_generate_moves(bb, player, moves);
+
+    unsigned long long nodes = 0;
+    for (int i = 0; i < size; i++) {
+        BitboardPosition child = *bb;
+        if (side) perft_play_side(&child, moves[i], 1);
+        else perft_play_side(&child, moves[i], 0);
+        nodes += perft_bitboards(&child, depth - 1, 1 - side);
+    }
+    return nodes;
+}
+
+/**
+ * @brief Compte les feuilles de l'arbre des coups jusqu'à une profondeur donnée
+ * 
+ * Parcourt l'arbre avec le générateur bitboard et la règle de capture de la
+ * recherche (captures_side()), mais sans contexte de recherche : chaque coup
+ * est joué sur une copie des bitboards par perft_play_side(), sans clé
+ * Zobrist ni termes de l'évaluation, et le dernier pli est compté par
+ * bitboard_count_moves(). Comme dans la recherche, les fins de partie ne
+ * coupent pas l'arbre. La partie n'est pas modifiée.
+ * 
+ * @param game Partie dont le joueur au trait est donné par le tour
+ * @param depth Profondeur en plis (0 = la position elle-même)
+ * @return unsigned long long Nombre de feuilles
+ */
+unsigned long long perft(Game * game, int depth) {
+    if (depth <= 0) return 1;
+
+    BitboardPosition bb;
+    bitboard_from_game(&bb, game);
+    return perft_bitboards(&bb, depth, game->turn & 1);
+}
+
+/**
+ * @brief Compte les feuilles avec le générateur mailbox de référence
+ * 
+ * Chaque coup de all_possible_moves() est joué par update_with_move() sur une
+ * copie de la partie : aucune brique de la recherche n'est utilisée. Sert de
+ * référence à perft() pour valider toute optimisation du plateau.
+ * 
+ * @param game Partie dont le joueur au trait est donné par le tour
+ * @param depth Profondeur en plis (0 = la position elle-même)
+ * @return unsigned long long Nombre de feuilles
+ */
+unsigned long long perft_reference(Game * game, int depth) {
+    if (depth <= 0) return 1;
+
+    Move moves[10 * 16];
+    int size = all_possible_moves(game, moves, current_player_turn(game));
+    if (depth == 1) return (unsigned long long)size;
+
+    unsigned long long nodes = 0;
+    for (int i = 0; i < size; i++) {
+        Game child = *game;
+        update_with_move(&child, moves[i]);
+        nodes += perft_reference(&child, depth - 1);
+    }
+    return nodes;
+}
+
+/**
+ * @brief Prépare la table de transposition pour une nouvelle recherche
+ */
+static void prepare_tt(void) {
+    // Allocation paresseuse de la table de transposition, conservée entre les coups
+    if (!tt_is_ready()) tt_init(TT_SIZE_MB);
+    tt_new_search();
+}
+
+/**
+ * @brief Recherche à profondeur fixe avec relevé des statistiques
+ * 
+ * Identique à minimax_best_move() ; les compteurs de la recherche sont
+ * recopiés dans stats. Utilisée par l'outil de benchmark.
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param depth Profondeur maximale de recherche dans l'arbre de jeu
+ * @param stats Statistiques de la recherche (ignoré si NULL)
+ * @return Move Le meilleur mouvement trouvé par l'algorithme
+ */
+Move minimax_best_move_stats(Game* game, int depth, SearchStats *stats) {
+    // Détermination du joueur actuel
+    Player current_player = ( (game->turn & 1) == 0) ? P1 : P2;
+
+    // Construction des bitboards et de la clé une seule fois pour toute la recherche
+    SearchContext *ctx = search_context_acquire();
+    if (ctx == NULL) {
+        LOG_ERROR_MSG("[IA] Allocation du contexte de recherche impossible");
+        return move_unpack(PACKED_MOVE_NONE);
+    }
+    search_context_from_game(ctx, game);
+    search_context_load_heuristics(ctx);
+    prepare_tt();
+
+    // Génération et tri des mouvements possibles, rangés dans le pli racine
+    PackedMove *possible_moves = ctx->stack[0].moves;
+    int size = order_moves(ctx, possible_moves, current_player, TT_NO_SQUARE, TT_NO_SQUARE);
+    
+    PackedMove best_move = PACKED_MOVE_NONE; // Aucun coup par défaut
+    int best_score = search_root(ctx, possible_moves, size, depth, -SEARCH_INFINITY, SEARCH_INFINITY, current_player, &best_move);
+    search_context_save_heuristics(ctx);
+
+    if (stats) {
+        stats->score = best_score;
+        stats->nodes = ctx->nodes;
+        stats->qnodes = ctx->qnodes;
+        stats->expanded = ctx->expanded;
+        stats->cutoffs = ctx->cutoffs;
+        stats->first_cutoffs = ctx->first_cutoffs;
+    }
+    search_context_release(ctx);
 
     // Affichage du résultat pour le débogage
     LOG_INFO_MSG("[IA] Best score: %d, Player 2: %d", best_score, (game->turn & 1) == 1);
+    return move_unpack(best_move);
+}
+
+/**
+ * @brief Nombre de contextes par thread d'une recherche partagée à profondeur fixe
+ * 
+ * Un nœud partagé imbriqué dans un autre est au moins un pli plus profond :
+ * sous un coup racine cherché à depth plis, au plus
+ * depth - YBW_MIN_SPLIT_DEPTH + 1 nœuds partagés s'imbriquent, chacun
+ * occupant un niveau de plus que celui qui l'englobe.
+ * 
+ * @param depth Profondeur de recherche sous chaque coup racine
+ * @return int Nombre de niveaux, entre 1 et YBW_MAX_LEVELS
+ */
+static int search_pool_levels(int depth) {
+    int levels = depth - YBW_MIN_SPLIT_DEPTH + 2;
+    if (levels < 1) return 1;
+    return (levels > YBW_MAX_LEVELS) ? YBW_MAX_LEVELS : levels;
+}
+
+/**
+ * @brief Prépare les threads et les contextes d'une recherche partagée
+ * 
+ * Les thread_count * levels contextes sont pris dans la réserve de
+ * search_context_acquire() et placés sur la position racine avant le
+ * lancement des threads : la recherche n'alloue ensuite plus rien et ne
+ * prend aucun verrou pour un contexte, un thread qui aide un nœud partagé
+ * prend son contexte du niveau suivant. Seuls les contextes de niveau 0
+ * reprennent les heuristiques mémorisées ; les autres lisent celles du nœud
+ * partagé qu'ils rejoignent.
+ * 
+ * @param pool Threads de la recherche
+ * @param thread_count Nombre de threads
+ * @param levels Contextes par thread (voir search_pool_levels())
+ * @param root Position racine
+ * @return int 0 en cas de succès, -1 si les contextes n'ont pas pu être alloués
+ */
+static int search_pool_init(SearchPool *pool, int thread_count, int levels, const SearchPosition *root) {
+    for (int thread = 0; thread < thread_count; thread++) {
+        for (int level = 0; level < levels; level++) {
+            SearchContext *ctx = search_context_acquire();
+            if (!ctx) {
+                // Contextes déjà pris rendus dans l'ordre inverse
+                for (int i = thread * levels + level - 1; i >= 0; i--) {
+                    search_context_release(pool->contexts[i / levels][i % levels]);
+                }
+                return -1;
+            }
+            pool->contexts[thread][level] = ctx;
+        }
+    }
+    pool->thread_count = thread_count;
+    pool->levels = levels;
+
+    for (int thread = 0; thread < thread_count; thread++) {
+        for (int level = 0; level < levels; level++) {
+            SearchContext *ctx = pool->contexts[thread][level];
+            search_context_init(ctx, root);
+            if (level == 0) search_context_load_heuristics(ctx);
+            ctx->pool = pool;
+            ctx->thread_id = thread;
+            ctx->level = level;
+        }
+        pthread_mutex_init(&pool->deques[thread].lock, NULL);
+        pool->deques[thread].top = 0;
+        pool->deques[thread].bottom = 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief Libère les files d'une recherche partagée et rend ses contextes à la réserve
+ * 
+ * Les contextes sont rendus dans l'ordre inverse de leur prise : la
+ * recherche suivante retrouve chaque contexte à la même place.
+ * 
+ * @param pool Threads préparés par search_pool_init()
+ */
+static void search_pool_destroy(SearchPool *pool) {
+    for (int thread = pool->thread_count - 1; thread >= 0; thread--) {
+        pthread_mutex_destroy(&pool->deques[thread].lock);
+        for (int level = pool->levels - 1; level >= 0; level--) {
+            search_context_release(pool->contexts[thread][level]);
+        }
+    }
+}
+
+/** @brief Nombre de rangs de coups racine codables dans une clé de RootSplit */
+#define ROOT_KEY_RANKS 65536
+
+/**
+ * @struct RootSplit
+ * @brief Recherche à profondeur fixe répartie coup racine par coup racine
+ * 
+ * Les coups racine sont distribués un à un aux threads, qui les cherchent
+ * chacun sur leur propre copie de la position. Le meilleur résultat est une
+ * clé atomique unique (voir root_key()) : son score sert de borne alpha
+ * commune à tous les threads. Un thread sans coup racine à chercher aide
+ * les nœuds partagés des autres (Young Brothers Wait, voir search_split()).
+ */
+typedef struct {
+    PackedMove *moves;      /**< Coups racine triés */
+    int size;               /**< Nombre de coups racine */
+    int depth;              /**< Profondeur de recherche sous chaque coup racine */
+    Player player;          /**< Joueur au trait à la racine */
+    atomic_int ready;       /**< 1 une fois le premier coup racine cherché */
+    atomic_int next;        /**< Rang du prochain coup racine à chercher */
+    atomic_int finished;    /**< Nombre de coups racine entièrement cherchés */
+    atomic_llong best;      /**< Meilleur score et rang de son coup */
+    SearchPool pool;        /**< Files de tâches des threads */
+} RootSplit;
+
+/**
+ * @struct RootWorker
+ * @brief Thread d'une recherche répartie sur les coups racine
+ */
+typedef struct {
+    RootSplit *split;       /**< Recherche partagée */
+    SearchContext *ctx;     /**< Contexte de niveau 0 du thread, sur sa copie de la position */
+    pthread_t thread;       /**< Thread système (inutilisé pour le thread 0) */
+} RootWorker;
+
+/**
+ * @brief Code un résultat racine en une clé ordonnée
+ * 
+ * La clé croît avec le score puis, à score égal, quand le rang diminue :
+ * le maximum des clés désigne le coup que retiendrait la recherche
+ * séquentielle, le premier des coups de meilleur score.
+ * 
+ * @param score Score du coup pour le joueur au trait
+ * @param index Rang du coup dans la liste triée
+ * @return long long Clé du résultat
+ */
+static inline long long root_key(int score, int index) {
+    return (long long)score * ROOT_KEY_RANKS + (ROOT_KEY_RANKS - 1 - index);
+}
+
+/** @brief Rang du coup d'une clé de root_key() */
+static inline int root_key_index(long long key) {
+    long long rest = key % ROOT_KEY_RANKS;
+    if (rest < 0) rest += ROOT_KEY_RANKS;
+    return ROOT_KEY_RANKS - 1 - (int)rest;
+}
+
+/** @brief Score d'une clé de root_key() */
+static inline int root_key_score(long long key) {
+    return (int)((key - (ROOT_KEY_RANKS - 1 - root_key_index(key))) / ROOT_KEY_RANKS);
+}
+
+/**
+ * @brief Borne alpha d'un coup racine d'après le meilleur résultat publié
+ * 
+ * Un coup de rang inférieur au meilleur l'emporte à égalité : sa borne est
+ * alors abaissée d'un point pour qu'un score égal soit encore re-cherché.
+ * 
+ * @param best Clé du meilleur résultat publié
+ * @param index Rang du coup racine
+ * @return int Borne alpha du coup
+ */
+static inline int root_split_alpha(long long best, int index) {
+    int alpha = root_key_score(best);
+    if (root_key_index(best) > index) alpha--;
+    return alpha;
+}
+
+/**
+ * @brief Cherche un coup racine et publie son score s'il améliore le meilleur
+ * 
+ * Comme à la racine séquentielle, le coup est d'abord cherché avec une
+ * fenêtre nulle à la borne alpha lue dans la clé partagée, puis avec une
+ * fenêtre ouverte s'il la dépasse. Entre les deux, la clé est relue : la
+ * borne de la re-recherche tient compte des frères terminés entre-temps.
+ * Seul un score qui dépasse cette borne est exact et publié.
+ * 
+ * @param worker Thread qui mène la recherche
+ * @param index Rang du coup racine
+ * @param full_window 1 pour chercher directement avec une fenêtre ouverte
+ */
+static void root_split_search(RootWorker *worker, int index, int full_window) {
+    RootSplit *split = worker->split;
+    SearchContext *ctx = worker->ctx;
+    SearchFrame *frame = &ctx->stack[ctx->ply];
+    PackedMove move = split->moves[index];
+
+    long long best = atomic_load(&split->best);
+    int alpha = full_window ? -SEARCH_INFINITY : root_split_alpha(best, index);
+
+    update_board_ai(&ctx->pos, move, &frame->undo);
+    frame->played = move;
+    ctx->ply++;
+
+    int score;
+    if (full_window) {
+        score = -search_negamax(ctx, split->depth, -SEARCH_INFINITY, SEARCH_INFINITY, split->player);
+    } else {
+        score = -search_negamax(ctx, split->depth, -alpha - 1, -alpha, split->player);
+        if (score > alpha) {
+            best = atomic_load(&split->best);
+            int raised = root_split_alpha(best, index);
+            if (raised > alpha) alpha = raised;
+            score = -search_negamax(ctx, split->depth, -SEARCH_INFINITY, -alpha, split->player);
+        }
+    }
+
+    ctx->ply--;
+    undo_board_ai(&ctx->pos, &frame->undo);
+    if (score <= alpha) return;
+
+    // Publication : la clé partagée ne fait que croître
+    long long key = root_key(score, index);
+    while (key > best && !atomic_compare_exchange_weak(&split->best, &best, key)) {
+    }
+}
+
+/**
+ * @brief Boucle d'un thread : cherche les coups racine non encore distribués
+ * 
+ * Tant que le premier coup racine n'est pas cherché, puis une fois les coups
+ * racine tous distribués, le thread vole des tâches dans les files des
+ * autres threads, jusqu'à ce que tous les coups racine soient cherchés.
+ * 
+ * @param arg Pointeur vers le RootWorker du thread
+ * @return void* Toujours NULL
+ */
+static void *root_split_run(void *arg) {
+    RootWorker *worker = (RootWorker *)arg;
+    RootSplit *split = worker->split;
+
+    while (atomic_load(&split->finished) < split->size) {
+        if (atomic_load(&split->ready)) {
+            int index = atomic_fetch_add(&split->next, 1);
+            if (index < split->size) {
+                root_split_search(worker, index, 0);
+                atomic_fetch_add(&split->finished, 1);
+                continue;
+            }
+        }
+
+        SplitPoint *task = pool_steal(&split->pool, worker->ctx->thread_id, NULL);
+        if (task) split_help(worker->ctx, task);
+        else sched_yield();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Recherche à profondeur fixe répartie entre ai_get_threads() threads
+ * 
+ * Le premier coup racine, supposé le meilleur grâce au tri, est cherché seul
+ * pour fixer la borne alpha ; les suivants sont répartis entre les threads,
+ * chacun sur sa copie de la position, la table de transposition restant
+ * partagée. Le coup retenu est le premier, dans l'ordre du tri, des coups de
+ * meilleur score : celui de la recherche séquentielle
+ * minimax_best_move_stats(), qui est utilisée telle quelle avec un seul thread.
+ * 
+ * Sous la racine, les nœuds à fenêtre nulle sont eux aussi partagés
+ * (Young Brothers Wait) : les threads restent occupés même quand il y a
+ * moins de coups racine restants que de threads.
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param depth Profondeur maximale de recherche dans l'arbre de jeu
+ * @param stats Statistiques cumulées sur tous les threads (ignoré si NULL)
+ * @return Move Le meilleur mouvement trouvé par l'algorithme
+ */
+Move minimax_best_move_parallel(Game* game, int depth, SearchStats *stats) {
+    int thread_count = ai_get_threads();
+    if (thread_count <= 1) return minimax_best_move_stats(game, depth, stats);
+
+    RootWorker *workers = calloc(thread_count, sizeof(RootWorker));
+    if (!workers) {
+        LOG_ERROR_MSG("[IA] Allocation des threads de recherche impossible");
+        return minimax_best_move_stats(game, depth, stats);
+    }
+    prepare_tt();
+
+    RootSplit *split = calloc(1, sizeof(RootSplit));
+    if (!split) {
+        free(workers);
+        LOG_ERROR_MSG("[IA] Allocation des threads de recherche impossible");
+        return minimax_best_move_stats(game, depth, stats);
+    }
+    PackedMove possible_moves[10 * 16];
+    split->moves = possible_moves;
+    split->depth = depth;
+    split->player = ((game->turn & 1) == 0) ? P1 : P2;
+    atomic_init(&split->ready, 0);
+    atomic_init(&split->next, 1);
+    atomic_init(&split->finished, 0);
+    atomic_init(&split->best, root_key(-SEARCH_INFINITY, 0));
+
+    // Position convertie une seule fois, puis copiée dans chaque contexte ;
+    // contextes de tous les niveaux préparés avant la recherche : aucune allocation pendant
+    SearchPosition root;
+    search_position_from_game(&root, game);
+    if (search_pool_init(&split->pool, thread_count, search_pool_levels(depth), &root) != 0) {
+        free(split);
+        free(workers);
+        LOG_ERROR_MSG("[IA] Allocation des threads de recherche impossible");
+        return minimax_best_move_stats(game, depth, stats);
+    }
+
+    for (int i = 0; i < thread_count; i++) {
+        workers[i].split = split;
+        workers[i].ctx = split->pool.contexts[i][0];
+    }
+
+    // Tri des coups racine
+    split->size = order_moves(workers[0].ctx, possible_moves, split->player, TT_NO_SQUARE, TT_NO_SQUARE);
+    PackedMove best_move = PACKED_MOVE_NONE;
+
+    // Lancement des threads auxiliaires, le thread appelant sert de thread 0
+    int started = 1;
+    for (; started < thread_count && split->size > 0; started++) {
+        if (pthread_create(&workers[started].thread, NULL, root_split_run, &workers[started]) != 0) {
+            LOG_ERROR_MSG("[IA] Échec du lancement du thread de recherche %d", started);
+            break;
+        }
+    }
+
+    // Premier coup racine avec la fenêtre complète, les autres threads aidant ses nœuds partagés
+    if (split->size > 0) {
+        root_split_search(&workers[0], 0, 1);
+        atomic_fetch_add(&split->finished, 1);
+        atomic_store(&split->ready, 1);
+        root_split_run(&workers[0]);
+    }
+    for (int i = 1; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    long long best = atomic_load(&split->best);
+    if (split->size > 0) {
+        best_move = possible_moves[root_key_index(best)];
+        search_context_save_heuristics(workers[0].ctx);
+    }
+
+    SearchStats total = {root_key_score(best), 0, 0, 0, 0, 0};
+    for (int i = 0; i < started; i++) {
+        for (int level = 0; level < split->pool.levels; level++) {
+            const SearchContext *ctx = split->pool.contexts[i][level];
+            total.nodes += ctx->nodes;
+            total.qnodes += ctx->qnodes;
+            total.expanded += ctx->expanded;
+            total.cutoffs += ctx->cutoffs;
+            total.first_cutoffs += ctx->first_cutoffs;
+        }
+    }
+    if (stats) *stats = total;
+    LOG_INFO_MSG("[IA] Best score: %d, Player 2: %d (%d threads, %lu nœuds)",
+                 total.score, (game->turn & 1) == 1, started, total.nodes);
+
+    search_pool_destroy(&split->pool);
+    free(split);
+    free(workers);
+    return move_unpack(best_move);
+}
+
+/**
+ * @brief Trouve le meilleur mouvement en utilisant l'algorithme minimax avec élagage alpha-bêta
+ * 
+ * Cette fonction explore tous les coups jusqu'à une profondeur fixe, sans
+ * limite de temps, avec ai_get_threads() threads (voir
+ * minimax_best_move_parallel()).
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param depth Profondeur maximale de recherche dans l'arbre de jeu
+ * @return Move Le meilleur mouvement trouvé par l'algorithme
+ */
+Move minimax_best_move(Game* game, int depth) {
+    return minimax_best_move_parallel(game, depth, NULL);
+}
+
+/**
+ * @struct SearchWorker
+ * @brief Thread de recherche Lazy SMP
+ * 
+ * Chaque thread mène sa propre recherche par approfondissement itératif sur
+ * une copie privée de la position ; seule la table de transposition est partagée.
+ */
+typedef struct {
+    SearchContext *ctx;     /**< Contexte de recherche sur une copie privée de la position */
+    int id;                 /**< Numéro du thread (0 = thread principal) */
+    int time_budget_ms;     /**< Temps de réflexion alloué */
+    long long start;        /**< Début de la recherche (horloge monotone, ms) */
+    PackedMove best_move;   /**< Meilleur coup de la dernière itération complète */
+    int best_score;         /**< Score de ce coup */
+    int completed_depth;    /**< Profondeur de la dernière itération complète */
+    pthread_t thread;       /**< Thread système (inutilisé pour le thread 0) */
+} SearchWorker;
+
+/** @brief Nombre de threads de recherche, 0 pour le nombre de cœurs disponibles */
+static int g_ai_threads = AI_THREADS;
+
+/**
+ * @brief Fixe le nombre de threads de recherche de l'IA
+ * 
+ * @param threads Nombre de threads (0 = nombre de cœurs disponibles)
+ */
+void ai_set_threads(int threads) {
+    if (threads < 0) threads = 0;
+    if (threads > AI_MAX_THREADS) threads = AI_MAX_THREADS;
+    g_ai_threads = threads;
+}
+
+/**
+ * @brief Nombre de threads effectivement utilisés par la recherche
+ * 
+ * @return int Nombre de threads (au moins 1)
+ */
+int ai_get_threads(void) {
+    if (g_ai_threads > 0) return g_ai_threads;
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1) return 1;
+    return (cores > AI_MAX_THREADS) ? AI_MAX_THREADS : (int)cores;
+}
+
+/**
+ * @brief Écrit la variation principale de la racine en notation réseau ("A1B2")
+ * 
+ * @param ctx Contexte de recherche
+ * @param buffer Tampon de sortie
+ * @param size Taille du tampon
+ */
+static void pv_format(const SearchContext *ctx, char *buffer, size_t size) {
+    size_t used = 0;
+    buffer[0] = '\0';
+    const SearchFrame *root = &ctx->stack[0];
+    for (int ply = 0; ply < root->pv_length && used + 6 <= size; ply++) {
+        char notation[5];
+        move_to_notation(move_unpack(root->pv[ply]), notation);
+        used += snprintf(buffer + used, size - used, "%s%s", ply ? " " : "", notation);
+    }
+}
+
+/**
+ * @brief Itération de l'approfondissement itératif avec fenêtre d'aspiration
+ * 
+ * À partir de ASPIRATION_MIN_DEPTH, la recherche commence avec une fenêtre
+ * étroite centrée sur le score de l'itération précédente : la plupart des
+ * coups racine sont alors réfutés plus vite. Si le score sort de la fenêtre,
+ * la borne dépassée est repoussée d'une marge doublée à chaque échec et la
+ * recherche est relancée ; après un échec haut, le coup qui l'a provoqué
+ * est exploré en premier.
+ * 
+ * @param ctx Contexte de recherche
+ * @param root_moves Coups racine, réordonnés après un échec haut
+ * @param size Nombre de coups racine
+ * @param depth Profondeur de l'itération
+ * @param worker Thread de recherche (score et profondeur de l'itération précédente)
+ * @param player Joueur au trait à la racine
+ * @param best_move Meilleur coup trouvé
+ * @return int Score exact du meilleur coup
+ */
+static int search_iteration(SearchContext *ctx, PackedMove *root_moves, int size, int depth, const SearchWorker *worker, Player player, PackedMove *best_move) {
+    if (depth < ASPIRATION_MIN_DEPTH || worker->completed_depth == 0) {
+        return search_root(ctx, root_moves, size, depth, -SEARCH_INFINITY, SEARCH_INFINITY, player, best_move);
+    }
+
+    int delta = ASPIRATION_WINDOW;
+    int alpha = worker->best_score - delta;
+    int beta = worker->best_score + delta;
+
+    while (1) {
+        PackedMove candidate = *best_move;
+        int score = search_root(ctx, root_moves, size, depth, alpha, beta, player, &candidate);
+        if (ctx->aborted) return score;
+
+        if (score <= alpha && alpha > -SEARCH_INFINITY) {
+            // Échec bas : aucun coup n'atteint alpha, le meilleur coup reste incertain
+            alpha = (alpha - delta > -SEARCH_INFINITY) ? alpha - delta : -SEARCH_INFINITY;
+        } else if (score >= beta && beta < SEARCH_INFINITY) {
+            // Échec haut : le coup trouvé est au moins aussi bon, il passe en tête
+            *best_move = candidate;
+            move_to_front(root_moves, size, candidate);
+            beta = (beta + delta < SEARCH_INFINITY) ? beta + delta : SEARCH_INFINITY;
+        } else {
+            *best_move = candidate;
+            return score;
+        }
+        delta *= 2;
+    }
+}
+
+/**
+ * @brief Approfondissement itératif mené par un thread de recherche
+ * 
+ * Les threads auxiliaires d'indice impair commencent à la profondeur 2 pour
+ * que les threads ne parcourent pas tous les mêmes itérations en même temps.
+ * Le thread 0 décide de la fin de la recherche et la signale aux autres
+ * threads par le drapeau d'arrêt.
+ * 
+ * @param arg Pointeur vers le SearchWorker
+ * @return void* NULL
+ */
+static void *search_worker_run(void *arg) {
+    SearchWorker *worker = (SearchWorker *)arg;
+    SearchContext *ctx = worker->ctx;
+    Player current_player = ((ctx->pos.turn & 1) == 0) ? P1 : P2;
+
+    PackedMove *possible_moves = ctx->stack[0].moves;
+    int size = order_moves(ctx, possible_moves, current_player, TT_NO_SQUARE, TT_NO_SQUARE);
+
+    // Repli si aucune itération ne se termine : meilleur coup selon le tri
+    if (size > 0) worker->best_move = possible_moves[0];
+
+    for (int depth = 1 + (worker->id & 1); size > 0 && depth <= MAX_SEARCH_DEPTH; depth++) {
+        // Le meilleur coup de l'itération précédente est exploré en premier
+        move_to_front(possible_moves, size, worker->best_move);
+
+        PackedMove iteration_best = worker->best_move;
+        int score = search_iteration(ctx, possible_moves, size, depth, worker, current_player, &iteration_best);
+        if (ctx->aborted) break;
+
+        worker->best_move = iteration_best;
+        worker->best_score = score;
+        worker->completed_depth = depth;
+
+        // Seul le thread principal journalise et décide de l'arrêt (le logger n'est pas thread-safe)
+        if (worker->id == 0) {
+            long long elapsed = now_ms() - worker->start;
+            char pv[SEARCH_MAX_PLY * 5 + 1];
+            pv_format(ctx, pv, sizeof(pv));
+            LOG_DEBUG_MSG("[IA] Profondeur %d : score %d, %lu nœuds, %lld ms, PV %s", depth, score, ctx->nodes, elapsed, pv);
+
+            // L'itération suivante coûte plusieurs fois la précédente : inutile de la commencer
+            if (elapsed * 2 >= worker->time_budget_ms) break;
+        }
+    }
+
+    if (worker->id == 0) atomic_store(ctx->stop, 1);
+    return NULL;
+}
+
+/**
+ * @brief Trouve le meilleur mouvement par approfondissement itératif dans un budget de temps
+ * 
+ * La recherche est relancée aux profondeurs 1, 2, 3, ... tant que l'échéance
+ * n'est pas atteinte. Le meilleur coup de chaque itération est exploré en
+ * premier à l'itération suivante ; la table de transposition fournit l'ordre
+ * des coups dans le reste de l'arbre. Une itération interrompue par
+ * l'échéance est abandonnée : le coup retourné est celui de la dernière
+ * itération complète (ou le premier coup trié si aucune ne s'est terminée).
+ * 
+ * Avec plusieurs threads (Lazy SMP), chaque thread mène cette même recherche
+ * sur sa propre copie de la position et profite des entrées que les autres
+ * écrivent dans la table de transposition partagée. Le coup retenu est celui
+ * de la plus profonde itération complète, tous threads confondus.
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param time_budget_ms Temps de réflexion alloué en millisecondes
+ * @return Move Le meilleur mouvement trouvé dans le temps imparti
+ */
+Move minimax_best_move_timed(Game* game, int time_budget_ms) {
+    return minimax_best_move_cancellable(game, time_budget_ms, NULL);
+}
+
+/**
+ * @brief Recherche dans un budget de temps, interruptible depuis un autre thread
+ * 
+ * Identique à minimax_best_move_timed(). Dès que *cancel devient non nul,
+ * tous les threads de recherche s'arrêtent et le coup de la dernière
+ * itération complète est retourné.
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @param time_budget_ms Temps de réflexion alloué en millisecondes
+ * @param cancel Drapeau d'annulation (NULL si la recherche n'est pas annulable)
+ * @return Move Le meilleur mouvement trouvé avant l'échéance ou l'annulation
+ */
+Move minimax_best_move_cancellable(Game* game, int time_budget_ms, atomic_int *cancel) {
+    Move best_move = move_unpack(PACKED_MOVE_NONE);
+    int thread_count = ai_get_threads();
+    long long start = now_ms();
+    atomic_int stop;
+    atomic_init(&stop, 0);
+
+    SearchWorker *workers = calloc(thread_count, sizeof(SearchWorker));
+    if (!workers) {
+        LOG_ERROR_MSG("[IA] Allocation des threads de recherche impossible");
+        return best_move;
+    }
+    prepare_tt();
+
+    // Position convertie une seule fois, puis copiée dans chaque thread
+    SearchPosition root;
+    search_position_from_game(&root, game);
+
+    for (int i = 0; i < thread_count; i++) {
+        workers[i].ctx = search_context_acquire();
+        if (!workers[i].ctx) {
+            for (int j = 0; j < i; j++) search_context_release(workers[j].ctx);
+            free(workers);
+            LOG_ERROR_MSG("[IA] Allocation des threads de recherche impossible");
+            return best_move;
+        }
+    }
+
+    for (int i = 0; i < thread_count; i++) {
+        SearchWorker *worker = &workers[i];
+        search_context_init(worker->ctx, &root);
+        search_context_load_heuristics(worker->ctx);
+        worker->ctx->deadline_ms = start + time_budget_ms;
+        worker->ctx->stop = &stop;
+        worker->ctx->cancel = cancel;
+        worker->id = i;
+        worker->time_budget_ms = time_budget_ms;
+        worker->start = start;
+        worker->best_move = PACKED_MOVE_NONE;
+        worker->best_score = -SEARCH_INFINITY;
+    }
+
+    // Lancement des threads auxiliaires, le thread appelant sert de thread 0
+    int started = 1;
+    for (; started < thread_count; started++) {
+        if (pthread_create(&workers[started].thread, NULL, search_worker_run, &workers[started]) != 0) {
+            LOG_ERROR_MSG("[IA] Échec du lancement du thread de recherche %d", started);
+            break;
+        }
+    }
+    search_worker_run(&workers[0]);
+    for (int i = 1; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    // Sélection de l'itération complète la plus profonde
+    SearchWorker *best = &workers[0];
+    unsigned long nodes = 0;
+    for (int i = 0; i < started; i++) {
+        if (workers[i].completed_depth > best->completed_depth) best = &workers[i];
+        nodes += workers[i].ctx->nodes;
+    }
+    best_move = move_unpack(best->best_move);
+    search_context_save_heuristics(workers[0].ctx);
+
+    LOG_INFO_MSG("[IA] Best score: %d, Player 2: %d, profondeur %d en %lld ms (%d threads, %lu nœuds)",
+                 best->best_score, (game->turn & 1) == 1, best->completed_depth, now_ms() - start, started, nodes);
+
+    for (int i = 0; i < thread_count; i++) search_context_release(workers[i].ctx);
+    free(workers);
     return best_move;
 }
 
+/**
+ * @brief Calcule le temps de réflexion disponible pour le tour en cours
+ * 
+ * Le budget AI_TIME_BUDGET_MS court depuis le début du tour (game->turn_timer) :
+ * le temps déjà écoulé avant l'appel de l'IA en est retiré, sans descendre
+ * sous un dixième du budget.
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @return int Temps de réflexion en millisecondes
+ */
+int ai_time_budget_ms(const Game *game) {
+    int budget = AI_TIME_BUDGET_MS;
+
+    if (game->turn_timer > 0) {
+        double elapsed = difftime(time(NULL), game->turn_timer);
+        if (elapsed > 0) budget -= (int)(elapsed * 1000);
+    }
+    if (budget < AI_TIME_BUDGET_MS / 10) budget = AI_TIME_BUDGET_MS / 10;
+
+    return budget;
+}
+
 /**
  * @brief Exécute un premier mouvement prédéfini pour l'IA
  * 
@@ -889,8 +3308,8 @@ void ai_next_move(Game* game) {
     Game copy = *game;
     copy.is_ai = 0; // Configuration pour éviter la récursion infinie
     
-    // Calcul du meilleur mouvement avec la profondeur configurée
-    Move best_move = minimax_best_move(&copy, DEPTH);
+    // Calcul du meilleur mouvement dans le temps imparti pour ce tour
+    Move best_move = minimax_best_move_timed(&copy, ai_time_budget_ms(game));
 
     // Si c'est le premier tour, jouer un mouvement d'ouverture fixe
 
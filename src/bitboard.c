@@ -0,0 +1,278 @@
+/**
+ * @file bitboard.c
+ * @brief Implémentation des bitboards et du générateur de coups de l'IA
+ *
+ * Ce fichier contient :
+ * - La conversion du plateau Game.board vers une position bitboard
+ * - La mise à jour case par case de la position pendant la recherche
+ * - La génération et le comptage des coups glissants
+ * - La génération des seuls coups de capture (quiescence)
+ * - Une variante de chaque générateur par camp, choisie une fois par appel
+ *
+ * Pour une direction donnée, le premier obstacle rencontré est le bit de plus
+ * petit indice (bas, droite) ou de plus grand indice (haut, gauche) parmi les
+ * cases occupées du rayon. Les destinations sont alors le rayon privé du rayon
+ * partant de cet obstacle.
+ *
+ * Les masques de rayons et de voisinage sont précalculés à la compilation
+ * par tools/gen_tables.c (bitboard_tables.h, inclus par bitboard.h).
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include "bitboard.h"
+
+/**
+ * @brief Construit la position bitboard d'une partie
+ *
+ * @param pos Position bitboard à remplir
+ * @param game Partie à convertir
+ * @return void
+ */
+void bitboard_from_game(BitboardPosition *pos, const Game *game) {
+    BitboardPosition empty = {{{0, 0}, {0, 0}}, {0, 0}, {{0, 0}, {0, 0}}};
+    *pos = empty;
+
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int col = 0; col < GRID_SIZE; col++) {
+            if (game->board[row][col] != P_NONE) {
+                bitboard_put(pos, BB_SQUARE(row, col), game->board[row][col]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Met à jour le contenu d'une case dans tous les plans
+ *
+ * @param pos Position bitboard
+ * @param square Case à modifier
+ * @param piece Nouveau contenu
+ * @return void
+ */
+void bitboard_put(BitboardPosition *pos, int square, Piece piece) {
+    bb_clear(&pos->pieces[0], square);
+    bb_clear(&pos->pieces[1], square);
+    bb_clear(&pos->kings, square);
+    bb_clear(&pos->visited[0], square);
+    bb_clear(&pos->visited[1], square);
+
+    switch (piece) {
+        case P1_KING:
+            bb_set(&pos->kings, square);
+            /* fall through */
+        case P1_PAWN:
+            bb_set(&pos->pieces[0], square);
+            break;
+        case P2_KING:
+            bb_set(&pos->kings, square);
+            /* fall through */
+        case P2_PAWN:
+            bb_set(&pos->pieces[1], square);
+            break;
+        case P1_VISITED:
+            bb_set(&pos->visited[0], square);
+            break;
+        case P2_VISITED:
+            bb_set(&pos->visited[1], square);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Destinations d'une pièce dans une direction donnée
+ *
+ * @param occupied Cases occupées par une pièce
+ * @param square Case de départ
+ * @param dir Direction (DIR_TOP, DIR_DOWN, DIR_LEFT, DIR_RIGHT)
+ * @return Bitboard Cases atteignables dans cette direction
+ */
+static inline Bitboard ray_moves(Bitboard occupied, int square, Direction dir) {
+    Bitboard ray = BB_RAYS[square][dir];
+    Bitboard blockers = bb_and(ray, occupied);
+    if (bb_is_empty(blockers)) return ray;
+
+    // Les directions haut et gauche décroissent les indices de case
+    int blocker = (dir == DIR_TOP || dir == DIR_LEFT) ? bb_msb(blockers) : bb_lsb(blockers);
+    Bitboard beyond = BB_RAYS[blocker][dir];
+    bb_set(&beyond, blocker);
+    return bb_andnot(ray, beyond);
+}
+
+/**
+ * @brief Destinations d'une pièce glissante
+ *
+ * @param pos Position bitboard
+ * @param square Case de la pièce
+ * @return Bitboard Cases d'arrivée possibles
+ */
+Bitboard bitboard_piece_moves(const BitboardPosition *pos, int square) {
+    Bitboard occupied = bb_occupied(pos);
+    Bitboard moves = ray_moves(occupied, square, DIR_TOP);
+    moves = bb_or(moves, ray_moves(occupied, square, DIR_DOWN));
+    moves = bb_or(moves, ray_moves(occupied, square, DIR_LEFT));
+    moves = bb_or(moves, ray_moves(occupied, square, DIR_RIGHT));
+    return moves;
+}
+
+/**
+ * @brief Génère tous les coups d'un camp connu à la compilation
+ *
+ * @param pos Position bitboard
+ * @param side Camp (0 = P1, 1 = P2), constant à chaque appel
+ * @param list Tableau de sortie
+ * @return int Nombre de coups générés
+ */
+SIDE_SPECIALIZED int generate_moves_side(const BitboardPosition *pos, int side, PackedMove *list) {
+    int size = 0;
+    Bitboard occupied = bb_occupied(pos);
+    Bitboard own = pos->pieces[side];
+
+    // Même ordre de directions que all_possible_moves : bas, haut, droite, gauche
+    static const Direction order[4] = {DIR_DOWN, DIR_TOP, DIR_RIGHT, DIR_LEFT};
+
+    while (!bb_is_empty(own)) {
+        int from = bb_pop_lsb(&own);
+
+        for (int d = 0; d < 4; d++) {
+            Bitboard targets = ray_moves(occupied, from, order[d]);
+            int descending = (order[d] == DIR_TOP || order[d] == DIR_LEFT);
+
+            // Extraction par distance croissante depuis la pièce
+            while (!bb_is_empty(targets)) {
+                int to = descending ? bb_pop_msb(&targets) : bb_pop_lsb(&targets);
+                list[size++] = packed_move(from, to);
+            }
+        }
+    }
+
+    return size;
+}
+
+/**
+ * @brief Génère tous les coups d'un joueur
+ *
+ * @param pos Position bitboard
+ * @param player Joueur (P1 ou P2)
+ * @param list Tableau de sortie
+ * @return int Nombre de coups générés
+ */
+int bitboard_generate_moves(const BitboardPosition *pos, Player player, PackedMove *list) {
+    return (player == P1) ? generate_moves_side(pos, 0, list) : generate_moves_side(pos, 1, list);
+}
+
+/**
+ * @brief Génère les coups de capture d'un camp connu à la compilation
+ *
+ * @param pos Position bitboard
+ * @param side Camp (0 = P1, 1 = P2), constant à chaque appel
+ * @param list Tableau de sortie
+ * @param king_threats 1 pour inclure les coups au contact du roi adverse
+ * @return int Nombre de coups générés
+ */
+SIDE_SPECIALIZED int generate_captures_side(const BitboardPosition *pos, int side, PackedMove *list, int king_threats) {
+    int size = 0;
+    Bitboard occupied = bb_occupied(pos);
+    Bitboard own = pos->pieces[side];
+    Bitboard enemy = pos->pieces[1 - side];
+
+    static const Direction order[4] = {DIR_DOWN, DIR_TOP, DIR_RIGHT, DIR_LEFT};
+
+    // Cases d'arrivée prenant en sandwich une pièce adverse : la victime est
+    // entre la case et un allié. La pièce qui se déplace ne peut pas être cet
+    // allié, car elle devrait traverser la victime pour atteindre la case.
+    Bitboard targets = {0, 0};
+    Bitboard victims = enemy;
+    while (!bb_is_empty(victims)) {
+        int victim = bb_pop_lsb(&victims);
+        for (int d = 0; d < 4; d++) {
+            int ally = BB_NEIGHBOUR[victim][d];
+            int landing = BB_NEIGHBOUR[victim][d ^ 1];
+            if (ally >= 0 && landing >= 0 && bb_test(own, ally)) bb_set(&targets, landing);
+        }
+    }
+
+    if (king_threats) {
+        Bitboard enemy_king = bb_and(pos->kings, enemy);
+        if (!bb_is_empty(enemy_king)) targets = bb_or(targets, BB_ADJACENT[bb_lsb(enemy_king)]);
+    }
+
+    while (!bb_is_empty(own)) {
+        int from = bb_pop_lsb(&own);
+
+        for (int d = 0; d < 4; d++) {
+            Direction dir = order[d];
+            int descending = (dir == DIR_TOP || dir == DIR_LEFT);
+            Bitboard moves = ray_moves(occupied, from, dir);
+            Bitboard hits = bb_and(moves, targets);
+
+            // Sprint : la pièce s'arrête contre un adversaire que rien ne protège derrière
+            Bitboard blockers = bb_and(BB_RAYS[from][dir], occupied);
+            if (!bb_is_empty(moves) && !bb_is_empty(blockers)) {
+                int blocker = descending ? bb_msb(blockers) : bb_lsb(blockers);
+                int behind = BB_NEIGHBOUR[blocker][dir];
+                int guarded = behind >= 0 && bb_test(enemy, behind);
+                if (bb_test(enemy, blocker) && !guarded) bb_set(&hits, BB_NEIGHBOUR[blocker][dir ^ 1]);
+            }
+
+            while (!bb_is_empty(hits)) {
+                int to = descending ? bb_pop_msb(&hits) : bb_pop_lsb(&hits);
+                list[size++] = packed_move(from, to);
+            }
+        }
+    }
+
+    return size;
+}
+
+/**
+ * @brief Génère les coups de capture d'un joueur
+ *
+ * @param pos Position bitboard
+ * @param player Joueur (P1 ou P2)
+ * @param list Tableau de sortie
+ * @param king_threats 1 pour inclure les coups au contact du roi adverse
+ * @return int Nombre de coups générés
+ */
+int bitboard_generate_captures(const BitboardPosition *pos, Player player, PackedMove *list, int king_threats) {
+    if (player == P1) return generate_captures_side(pos, 0, list, king_threats);
+    return generate_captures_side(pos, 1, list, king_threats);
+}
+
+/**
+ * @brief Compte les coups d'un camp connu à la compilation
+ *
+ * @param pos Position bitboard
+ * @param side Camp (0 = P1, 1 = P2), constant à chaque appel
+ * @return int Nombre de coups légaux
+ */
+SIDE_SPECIALIZED int count_moves_side(const BitboardPosition *pos, int side) {
+    int count = 0;
+    Bitboard occupied = bb_occupied(pos);
+    Bitboard own = pos->pieces[side];
+
+    while (!bb_is_empty(own)) {
+        int square = bb_pop_lsb(&own);
+        Bitboard moves = ray_moves(occupied, square, DIR_TOP);
+        moves = bb_or(moves, ray_moves(occupied, square, DIR_DOWN));
+        moves = bb_or(moves, ray_moves(occupied, square, DIR_LEFT));
+        moves = bb_or(moves, ray_moves(occupied, square, DIR_RIGHT));
+        count += bb_popcount(moves);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Compte les coups d'un joueur
+ *
+ * @param pos Position bitboard
+ * @param player Joueur (P1 ou P2)
+ * @return int Nombre de coups légaux
+ */
+int bitboard_count_moves(const BitboardPosition *pos, Player player) {
+    return (player == P1) ? count_moves_side(pos, 0) : count_moves_side(pos, 1);
+}
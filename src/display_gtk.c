@@ -19,6 +19,7 @@
 #include "display_gtk.h"
 #include "game.h"
 #include "input.h"
+#include "ai_worker.h"
 #include "const.h"
 #include "logging.h"
 
@@ -214,8 +215,8 @@ static gboolean is_possible_move(int row, int col) {
  */
 void draw_ui(cairo_t *cr, Game *game, int start_x, int start_y, int grid_width, int grid_height) {
     // Calcul des scores en temps réel
-    int player_one_score = score_player_one(*game);
-    int player_two_score = score_player_two(*game);
+    int player_one_score = player_score(game, P1);
+    int player_two_score = player_score(game, P2);
 
     // Configuration du rendu de texte
     char score_text[50];
@@ -359,7 +360,7 @@ void draw_callback(GtkDrawingArea *area G_GNUC_UNUSED, cairo_t *cr, int width, i
     // Rendu de chaque cellule de la grille
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-            int tile = game->board[j][i];
+            Piece tile = game->board[j][i];
 
             // Couleur de base selon la position spéciale ou normale
             if (i + j == 0) {
@@ -393,22 +394,22 @@ void draw_callback(GtkDrawingArea *area G_GNUC_UNUSED, cairo_t *cr, int width, i
                 const char *symbol = NULL;
 
                 // Sélection du symbole selon le type de pièce
-                if (tile == P1_KING || tile == P2_KING) {
+                if (piece_is_king(tile)) {
                     symbol = "♔";
-                } else if (tile == P1_PAWN || tile == P2_PAWN) {
+                } else if (piece_owner(tile) != NOT_PLAYER) {
                     symbol = "♜";
                 }
 
                 // Couleur selon l'équipe
-                switch (tile) {
-                    case P1_PAWN:
-                    case P1_KING:
+                switch (piece_owner(tile)) {
+                    case P1:
                         cairo_set_source_rgb(cr, 0.1, 0.4, 0.8); // Bleu pour P1
                         break;
-                    case P2_PAWN:
-                    case P2_KING:
+                    case P2:
                         cairo_set_source_rgb(cr, 0.8, 0.1, 0.1); // Rouge pour P2
                         break;
+                    default:
+                        break;
                 }
 
                 // Rendu centré du symbole Unicode
@@ -493,8 +494,8 @@ static void on_mouse_click(GtkGestureClick *gesture, gint n_press, gdouble x, gd
 
                 // Validation d'appartenance au joueur courant
                 Player current_player = current_player_turn(game);
-                Player piece_owner = get_player(game->board[row][col]);
-                if (piece_owner != current_player) {
+                Player owner = piece_owner(game->board[row][col]);
+                if (owner != current_player) {
                     LOG_INFO_MSG("[CLICK] Impossible de sélectionner une pièce adverse !");
                     return;
                 }
@@ -648,5 +649,8 @@ int initialize_display(int argc, char** argv, Game* game) {
     g_signal_connect(app, "activate", G_CALLBACK(on_app_activate), game);
     int status = g_application_run(G_APPLICATION(app), argc, argv);
     g_object_unref(app);
+
+    // Arrêt d'une éventuelle recherche de l'IA avant de quitter
+    ai_worker_shutdown();
     return status;
 }
@@ -22,6 +22,7 @@
 #include "input.h"
 #include "const.h"
 #include "algo.h"
+#include "mailbox.h"
 
 /**
  * @brief Initialise une nouvelle partie avec le mode et l'IA spécifiés
@@ -59,49 +60,53 @@ Game init_game(GameMode mode, int artificial_intelligence) {
     game.game_mode = mode;
     game.is_ai = artificial_intelligence ? 1 : 0;
 
+    // Début du premier tour
+    game.turn_timer = time(NULL);
+
     return game;
 }
 
 /**
- * @brief Calcule le score du joueur 1 (Bleu)
+ * @brief Calcule le score d'un joueur sans copier la partie
  * 
  * Le score est calculé selon les règles suivantes :
- * - +1 point par case visitée (P1_VISITED)
+ * - +1 point par case visitée par le joueur
  * - +2 points par pièce encore en vie (pions et roi)
  * 
- * @param game Structure de jeu contenant l'état actuel du plateau
- * @return int Score total du joueur 1
+ * @param game Partie à analyser (non modifiée)
+ * @param player Joueur dont le score est calculé (P1 ou P2)
+ * @return int Score total du joueur
  */
-int score_player_one(Game game) {
-    int player_one_score = 0;
+int player_score(const Game *game, Player player) {
+    Piece visited = piece_visited_by(player);
+    int score = 0;
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-            if (game.board[i][j] == P1_VISITED) player_one_score++;
-            if (get_player(game.board[i][j]) == P1) player_one_score += 2;
+            if (game->board[i][j] == visited) score++;
+            if (piece_owner(game->board[i][j]) == player) score += 2;
         }
     }
-    return player_one_score;
+    return score;
 }
 
 /**
- * @brief Calcule le score du joueur 2 (Rouge)
+ * @brief Calcule le score du joueur 1 (Bleu)
  * 
- * Le score est calculé selon les règles suivantes :
- * - +1 point par case visitée (P2_VISITED)
- * - +2 points par pièce encore en vie (pions et roi)
+ * @param game Structure de jeu contenant l'état actuel du plateau
+ * @return int Score total du joueur 1
+ */
+int score_player_one(Game game) {
+    return player_score(&game, P1);
+}
+
+/**
+ * @brief Calcule le score du joueur 2 (Rouge)
  * 
  * @param game Structure de jeu contenant l'état actuel du plateau
  * @return int Score total du joueur 2
  */
 int score_player_two(Game game) {
-    int player_two_score = 0;
-    for (int i = 0; i < GRID_SIZE; i++) {
-        for (int j = 0; j < GRID_SIZE; j++) {
-            if (game.board[i][j] == P2_VISITED) player_two_score++;
-            if (get_player(game.board[i][j]) == P2) player_two_score += 2;
-        }
-    }
-    return player_two_score;
+    return player_score(&game, P2);
 }
 
 /**
@@ -122,31 +127,28 @@ int score_player_two(Game game) {
  * @param dst_col Colonne destination (0 à GRID_SIZE-1)
  * @return int 1 si le déplacement est légal, 0 sinon
  */
-int is_move_legal(Game *game, int src_row, int src_col, int dst_row, int dst_col) {
+int is_move_legal(const Game *game, int src_row, int src_col, int dst_row, int dst_col) {
     // Vérification des limites du plateau pour source et destination
     if (src_row < 0 || src_row >= GRID_SIZE || src_col < 0 || src_col >= GRID_SIZE) return 0;
     if (dst_row < 0 || dst_row >= GRID_SIZE || dst_col < 0 || dst_col >= GRID_SIZE) return 0;
 
     // Vérification qu'une pièce existe à la position source
-    if (get_player(game->board[src_row][src_col]) == NOT_PLAYER) return 0;
+    if (piece_owner(game->board[src_row][src_col]) == NOT_PLAYER) return 0;
 
     // Vérification que le déplacement est en ligne droite uniquement
     if (src_row != dst_row && src_col != dst_col) return 0;
 
     // Vérification que la destination est libre
-    if (get_player(game->board[dst_row][dst_col]) != NOT_PLAYER) return 0;
+    if (piece_owner(game->board[dst_row][dst_col]) != NOT_PLAYER) return 0;
 
     // Vérification que le joueur déplace bien sa propre pièce
-    if ((current_player_turn(game) == P1) &&
-        (game->board[src_row][src_col] == P2_PAWN || game->board[src_row][src_col] == P2_KING)) return 0;
-    if ((current_player_turn(game) == P2) &&
-        (game->board[src_row][src_col] == P1_PAWN || game->board[src_row][src_col] == P1_KING)) return 0;
+    if (piece_owner(game->board[src_row][src_col]) != current_player_turn(game)) return 0;
 
     // Vérification du chemin libre pour déplacement horizontal
     if (src_row == dst_row) {
         int step = (dst_col > src_col) ? 1 : -1;
         for (int c = src_col + step; c != dst_col; c += step) {
-            if (get_player(game->board[src_row][c]) != NOT_PLAYER) return 0; // chemin bloqué
+            if (piece_owner(game->board[src_row][c]) != NOT_PLAYER) return 0; // chemin bloqué
         }
     }
 
@@ -154,7 +156,7 @@ int is_move_legal(Game *game, int src_row, int src_col, int dst_row, int dst_col
     if (src_col == dst_col) {
         int step = (dst_row > src_row) ? 1 : -1;
         for (int r = src_row + step; r != dst_row; r += step) {
-            if (get_player(game->board[r][src_col]) != NOT_PLAYER) return 0; // chemin bloqué
+            if (piece_owner(game->board[r][src_col]) != NOT_PLAYER) return 0; // chemin bloqué
         }
     }
 
@@ -166,15 +168,14 @@ int is_move_legal(Game *game, int src_row, int src_col, int dst_row, int dst_col
  * 
  * Cette fonction analyse le type de pièce et retourne le joueur
  * correspondant ou NOT_PLAYER si la case est vide ou contient
- * une case visitée.
+ * une case visitée. Le joueur est lu directement dans les bits
+ * PIECE_OWNER_MASK de la case (voir piece_owner()).
  * 
  * @param piece Type de pièce à analyser
  * @return Player P1, P2 ou NOT_PLAYER selon le type de pièce
  */
 Player get_player(Piece piece) {
-    if (piece == P1_PAWN || piece == P1_KING) return P1;
-    if (piece == P2_PAWN || piece == P2_KING) return P2;
-    return NOT_PLAYER;
+    return piece_owner(piece);
 }
 
 /**
@@ -194,122 +195,82 @@ Player get_player(Piece piece) {
  */
 void did_eat(Game* game, int row, int col, Direction sprint_direction) {
     Player player = current_player_turn(game);
-    Player opponent = (player == P1) ? P2 : P1;
-    
-    // Analyse des joueurs dans les 4 directions adjacentes
-    Player top = (row - 1 >= 0)? get_player(game->board[row - 1][col]) : NOT_PLAYER;
-    Player left = (col - 1 >= 0)? get_player(game->board[row][col - 1]) : NOT_PLAYER;
-    Player right = (col + 1 < GRID_SIZE)? get_player(game->board[row][col + 1]) : NOT_PLAYER;
-    Player down = (row + 1 < GRID_SIZE)? get_player(game->board[row + 1][col]) : NOT_PLAYER;
-
-    // Vérification capture vers le haut
-    if (top == opponent) {
-        if ( ((row - 2 < 0 || get_player(game->board[row - 2][col]) != opponent) && sprint_direction == DIR_TOP ) ||
-              (get_player(game->board[row - 2][col]) == player && row - 2 >= 0) )  {
-            game->board[row - 1][col] = P_NONE;
-        }
-    }
+    Mailbox mb;
+    int captured[4];
 
-    // Vérification capture vers la gauche
-    if (left == opponent) {
-        if ( ((col - 2 < 0 || get_player(game->board[row][col - 2]) != opponent) && sprint_direction == DIR_LEFT ) ||
-              (get_player(game->board[row][col - 2]) == player && col - 2 >= 0) ) {
-            game->board[row][col - 1] = P_NONE;
-        }
-    }
-
-    // Vérification capture vers la droite
-    if (right == opponent) {
-        if ( ((col + 2 >= GRID_SIZE || get_player(game->board[row][col + 2]) != opponent) && sprint_direction == DIR_RIGHT ) ||
-              (get_player(game->board[row][col + 2]) == player && col + 2 < GRID_SIZE) ) {
-            game->board[row][col + 1] = P_NONE;
-        }
-    }
+    // Plateau bordé : les voisins hors plateau sont des sentinelles sans propriétaire
+    mailbox_from_game(&mb, game);
+    int count = mailbox_captures(&mb, MB_SQUARE(row, col), sprint_direction, player, captured);
 
-    // Vérification capture vers le bas
-    if (down == opponent) {
-        if ( ((row + 2 >= GRID_SIZE || get_player(game->board[row + 2][col]) != opponent) && sprint_direction == DIR_DOWN ) ||
-              (get_player(game->board[row + 2][col]) == player && row + 2 < GRID_SIZE) ) {
-            game->board[row + 1][col] = P_NONE;
-        }
+    for (int i = 0; i < count; i++) {
+        game->board[MB_ROW(captured[i])][MB_COL(captured[i])] = P_NONE;
     }
 }
 
 /**
- * @brief Vérifie les conditions de victoire et met à jour l'état du jeu
+ * @brief Détermine le vainqueur d'une partie sans la modifier
  * 
- * Cette fonction vérifie plusieurs conditions de victoire dans l'ordre :
+ * Les conditions de victoire sont vérifiées dans l'ordre :
  * 1. Victoire par objectif : roi P1 atteint coin bas-droit, roi P2 atteint coin haut-gauche
  * 2. Victoire par élimination : un des rois est capturé
  * 3. Victoire par domination : un joueur n'a plus que 2 pièces (roi + 1 soldat)
  * 4. Victoire par score : après 63 tours, le joueur avec le meilleur score gagne
  * 
- * @param game Pointeur vers la structure de jeu
- * @return void
+ * Une victoire déjà enregistrée dans game->won est conservée.
+ * 
+ * @param game Pointeur vers la structure de jeu (non modifiée)
+ * @return Player P1, P2, DRAW, ou NOT_PLAYER si la partie continue
  */
-void won(Game* game) {
+Player compute_winner(const Game *game) {
+    if (game->won != NOT_PLAYER) return game->won;
+
     // Vérification victoire par objectif (atteindre le coin opposé)
-    if (game->board[GRID_SIZE-1][GRID_SIZE-1] == P1_KING && game->won == NOT_PLAYER) {
-        game->won = P1;
-    } else if (game->board[0][0] == P2_KING && game->won == NOT_PLAYER) {
-        game->won = P2;
-    }
+    if (game->board[GRID_SIZE-1][GRID_SIZE-1] == P1_KING) return P1;
+    if (game->board[0][0] == P2_KING) return P2;
 
-    // Vérification de la survie des rois
+    // Comptage des rois et des pièces restantes en un seul parcours
     int is_blue_king_alive = 0;
     int is_red_king_alive = 0;
+    int p1_piece = 0;
+    int p2_piece = 0;
     for (int i = 0; i < GRID_SIZE; i++) {
         for (int j = 0; j < GRID_SIZE; j++) {
-            if (game->board[i][j] == P1_KING) is_blue_king_alive++;
-            if (game->board[i][j] == P2_KING) is_red_king_alive++;
+            Piece piece = game->board[i][j];
+            if (piece == P1_KING) is_blue_king_alive++;
+            if (piece == P2_KING) is_red_king_alive++;
+            Player owner = piece_owner(piece);
+            if (owner == P1) p1_piece++;
+            if (owner == P2) p2_piece++;
         }
     }
 
     // Victoire par élimination du roi adverse
-    if ((!is_blue_king_alive || !is_red_king_alive) && game->won == NOT_PLAYER) {
-        if (!is_blue_king_alive) {
-            game->won=P2;
-        } else if (!is_red_king_alive) {
-            game->won=P1;
-        } else {
-            game->won=NOT_PLAYER;
-        }
-    }
-
-    // Victoire par domination (adversaire réduit à 2 pièces)
-    if (game->won == NOT_PLAYER) {
-        int p1_piece = 0;
-        int p2_piece = 0;
-
-        // Comptage des pièces restantes pour chaque joueur
-        for (int i = 0; i < GRID_SIZE; i++) {
-            for (int j = 0; j < GRID_SIZE; j++) {
-                if (game->board[i][j] == P1_PAWN || game->board[i][j] == P1_KING) {
-                    p1_piece++;
-                }
-                if (game->board[i][j] == P2_PAWN || game->board[i][j] == P2_KING) {
-                    p2_piece++;
-                }
-            }
-        }
+    if (!is_blue_king_alive) return P2;
+    if (!is_red_king_alive) return P1;
 
-        // Victoire si l'adversaire n'a plus que roi + 1 soldat
-        if (p1_piece <= 2) {
-            game->won = P2;
-        } else if (p2_piece <= 2) {
-            game->won = P1;
-        }
-    }
+    // Victoire si l'adversaire n'a plus que roi + 1 soldat
+    if (p1_piece <= 2) return P2;
+    if (p2_piece <= 2) return P1;
 
     // Victoire par score après 63 tours
-    if (game->turn >= 63 && game->won == NOT_PLAYER) {
-        int counter = score_player_one(*game) - score_player_two(*game);
-        if (counter != 0) {
-            game->won = (counter > 0) ? P1 : P2;
-        } else {
-            game->won = DRAW;
-        }
+    if (game->turn >= 63) {
+        int counter = player_score(game, P1) - player_score(game, P2);
+        if (counter == 0) return DRAW;
+        return (counter > 0) ? P1 : P2;
     }
+    return NOT_PLAYER;
+}
+
+/**
+ * @brief Vérifie les conditions de victoire et met à jour l'état du jeu
+ * 
+ * Enregistre dans game->won le résultat de compute_winner().
+ * 
+ * @param game Pointeur vers la structure de jeu
+ * @return void
+ */
+void won(Game* game) {
+    game->won = compute_winner(game);
 }
 
 /**
@@ -357,7 +318,7 @@ void update_board(Game *game, int dst_row, int dst_col) {
     if (is_move_legal(game, src_row, src_col, dst_row, dst_col)) {
         // Déplacement de la pièce et marquage de la case source
         game->board[dst_row][dst_col] = game->board[src_row][src_col];
-        game->board[src_row][src_col] = (get_player(game->board[src_row][src_col]) == P1) ? P1_VISITED : P2_VISITED;
+        game->board[src_row][src_col] = piece_visited_by(piece_owner(game->board[src_row][src_col]));
 
         // Détermination de la direction du mouvement pour les captures
         Direction direction = NONE;
@@ -383,6 +344,7 @@ void update_board(Game *game, int dst_row, int dst_col) {
 
         // Avancement du tour et reset de la sélection
         game->turn++;
+        game->turn_timer = time(NULL);
         game->selected_tile[0] = -1;
         game->selected_tile[1] = -1;
 
@@ -403,6 +365,6 @@ void update_board(Game *game, int dst_row, int dst_col) {
  * @param game Pointeur vers la structure de jeu
  * @return Player P1 pour les tours pairs, P2 pour les tours impairs
  */
-Player current_player_turn(Game *game) {
+Player current_player_turn(const Game *game) {
     return (game->turn % 2 == 0) ? P1 : P2;
 }
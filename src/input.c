@@ -26,6 +26,7 @@
 #include "move_util.h"
 #include "const.h"
 #include "algo.h"
+#include "ai_worker.h"
 #include "logging.h"
 
 /**
@@ -44,7 +45,8 @@ typedef struct {
  * 
  * Cette fonction est appelée de manière asynchrone par GTK pour permettre à l'IA
  * de jouer son coup sans bloquer l'interface utilisateur. Elle vérifie si c'est
- * toujours le tour de l'IA et exécute le mouvement approprié selon le mode de jeu.
+ * toujours le tour de l'IA et confie la recherche au thread de l'IA : le coup
+ * est appliqué plus tard dans la boucle GTK par ai_worker_deliver().
  * 
  * @param data Pointeur vers la structure AITask contenant le contexte
  * @return gboolean G_SOURCE_REMOVE pour supprimer le callback après exécution
@@ -68,14 +70,9 @@ gboolean ai_delayed_callback(gpointer data) {
         is_ai_turn = 1;
     }
     
-    // Exécution du mouvement IA selon le mode de jeu
+    // Lancement de la recherche sur le thread de l'IA
     if (is_ai_turn) {
-        if (game->game_mode == LOCAL) {
-            ai_next_move(game);
-            display_request_redraw();
-        } else {
-            ai_network_move(game);
-        }
+        ai_worker_request(game);
     }
     
     // Libération de la mémoire et suppression du callback
@@ -94,8 +91,8 @@ void send_message_to_client(int server_socket, const char *move4);  /**< Envoi m
  * @brief Exécute un mouvement de l'IA en mode réseau
  * 
  * Cette fonction calcule le meilleur coup pour l'IA en utilisant l'algorithme minimax,
- * convertit le mouvement au format réseau, l'envoie au joueur distant, puis l'applique
- * localement. Elle gère différemment les modes serveur et client.
+ * puis le transmet et l'applique avec ai_network_play(). La recherche est bloquante :
+ * depuis la boucle GTK, passer par ai_worker_request().
  * 
  * @param game Pointeur vers la structure de jeu principale
  * @return void
@@ -110,11 +107,27 @@ void ai_network_move(Game *game) {
     
     LOG_INFO_MSG("[AI] IA %s (%s) calcule son prochain coup...", mode_name, player_name);
     
-    // Calcul du meilleur mouvement avec l'algorithme minimax
+    // Calcul du meilleur mouvement avec l'algorithme minimax dans le temps imparti
     Game copy = *game;
     copy.is_ai = 0; // Prévention de la récursion dans l'IA
-    Move best_move = minimax_best_move(&copy, DEPTH);
+    Move best_move = minimax_best_move_timed(&copy, ai_time_budget_ms(game));
     
+    ai_network_play(game, best_move);
+}
+
+/**
+ * @brief Transmet puis applique un mouvement de l'IA en mode réseau
+ * 
+ * Le mouvement est converti au format réseau, envoyé au joueur distant,
+ * puis appliqué localement. Elle gère différemment les modes serveur et client.
+ * 
+ * @param game Pointeur vers la structure de jeu principale
+ * @param best_move Mouvement choisi par l'IA
+ * @return void
+ */
+void ai_network_play(Game *game, Move best_move) {
+    const char* mode_name = (game->game_mode == SERVER) ? "SERVER" : "CLIENT";
+
     // Validation du mouvement calculé
     if (best_move.src_row < 0 || best_move.src_col < 0) {
         LOG_INFO_MSG("[AI] Aucun coup valide trouvé");
@@ -123,11 +136,7 @@ void ai_network_move(Game *game) {
     
     // Conversion du mouvement au format réseau (ex: "A1B2")
     char move[5];
-    move[0] = COLS_MAP[best_move.src_col];
-    move[1] = (char)('9' - best_move.src_row);
-    move[2] = COLS_MAP[best_move.dst_col];
-    move[3] = (char)('9' - best_move.dst_row);
-    move[4] = '\0';
+    move_to_notation(best_move, move);
     
     LOG_INFO_MSG("[AI] IA %s joue: %s (de %c%c à %c%c)", mode_name, move, move[0], move[1], move[2], move[3]);
     
@@ -0,0 +1,66 @@
+/**
+ * @file mailbox.c
+ * @brief Implémentation du plateau bordé et de la règle de capture
+ *
+ * Ce fichier contient :
+ * - Les décalages des directions et des voisins sur le plateau bordé
+ * - La conversion du plateau Game.board vers le plateau bordé
+ * - La règle de capture partagée par did_eat() et la recherche de l'IA
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <string.h>
+
+#include "mailbox.h"
+
+const int MB_DIRECTION[4] = {-MB_SIZE, MB_SIZE, -1, 1}; // Ordre de l'énumération Direction
+
+const int MB_SURROUNDING[8] = {
+    -MB_SIZE - 1, -MB_SIZE, -MB_SIZE + 1,
+    -1,                     1,
+    MB_SIZE - 1,  MB_SIZE,  MB_SIZE + 1
+};
+
+/**
+ * @brief Construit le plateau bordé d'une partie
+ *
+ * @param mb Plateau bordé à remplir
+ * @param game Partie à convertir
+ * @return void
+ */
+void mailbox_from_game(Mailbox *mb, const Game *game) {
+    memset(mb->cells, MB_OFFBOARD, sizeof(mb->cells));
+
+    for (int row = 0; row < GRID_SIZE; row++) {
+        memcpy(&mb->cells[MB_SQUARE(row, 0)], game->board[row], GRID_SIZE * sizeof(Piece));
+    }
+}
+
+/**
+ * @brief Cherche les pièces capturées par une pièce arrivant sur une case
+ *
+ * @param mb Plateau bordé, pièce déjà posée sur square
+ * @param square Case d'arrivée (indice MB_SQUARE)
+ * @param sprint_direction Direction du déplacement
+ * @param player Joueur qui vient de jouer
+ * @param captured Cases capturées (au plus 4), dans l'ordre de Direction
+ * @return int Nombre de pièces capturées
+ */
+int mailbox_captures(const Mailbox *mb, int square, Direction sprint_direction, Player player, int captured[4]) {
+    Player opponent = (player == P1) ? P2 : P1;
+    int count = 0;
+
+    for (int d = 0; d < 4; d++) {
+        int neighbour = square + MB_DIRECTION[d];
+        if (piece_owner(mb->cells[neighbour]) != opponent) continue;
+
+        // Case derrière l'adversaire : sentinelle si le voisin est au bord
+        Player behind = piece_owner(mb->cells[neighbour + MB_DIRECTION[d]]);
+        if (behind == player || (behind != opponent && sprint_direction == (Direction)d)) {
+            captured[count++] = neighbour;
+        }
+    }
+    return count;
+}
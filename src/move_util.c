@@ -18,6 +18,7 @@
 #include "move_util.h"
 #include "display_gtk.h"
 #include "game.h"
+#include "algo.h"
 
 #include <gtk/gtk.h>
 
@@ -59,17 +60,14 @@ gboolean apply_move_idle(gpointer data) {
  * @return void
  */
 void post_move_to_gtk(Game *game, const char m[4]) {
-    int sc = col_from_letter(m[0]);
-    int sr = 9 - (m[1] - '0');
-    int dc = col_from_letter(m[2]);
-    int dr = 9 - (m[3] - '0');
+    Move move;
 
-    if (sc < 0 || dc < 0 || sr < 0 || sr > 8 || dr < 0 || dr > 8) {
+    if (move_from_notation(m, &move) < 0) {
         g_warning("[RX] Mouvement invalide: %c%c%c%c", m[0],m[1],m[2],m[3]);
         return;
     }
 
     MoveTask *t = g_new0(MoveTask, 1);
-    t->game = game; t->sr = sr; t->sc = sc; t->dr = dr; t->dc = dc;
+    t->game = game; t->sr = move.src_row; t->sc = move.src_col; t->dr = move.dst_row; t->dc = move.dst_col;
     g_idle_add(apply_move_idle, t);
 }
@@ -0,0 +1,136 @@
+/**
+ * @file position.c
+ * @brief Implémentation de la lecture et de l'écriture de positions texte
+ *
+ * Ce fichier contient :
+ * - La lecture d'une position "<plateau> <tour>"
+ * - L'écriture d'une position au même format
+ * - Le chargement des fichiers de positions utilisés par perft et bench
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "position.h"
+#include "const.h"
+#include "logging.h"
+
+/**
+ * @brief Construit une partie à partir d'une position texte
+ *
+ * @param game Partie à remplir
+ * @param text Position à lire
+ * @return int Nombre de caractères lus, -1 si invalide
+ */
+int position_parse(Game *game, const char *text) {
+    const char *p = text;
+    *game = init_game(LOCAL, 0);
+
+    while (isspace((unsigned char)*p)) p++;
+
+    for (int row = 0; row < GRID_SIZE; row++) {
+        if (row > 0 && *p++ != '/') return -1;
+        for (int col = 0; col < GRID_SIZE; col++) {
+            if (*p < '0' || *p >= '0' + PIECE_KIND_COUNT) return -1;
+            game->board[row][col] = PIECE_KINDS[*p++ - '0'];
+        }
+    }
+
+    // Tour facultatif, séparé du plateau par des espaces
+    const char *after_board = p;
+    while (*p == ' ' || *p == '\t') p++;
+    if (isdigit((unsigned char)*p)) {
+        char *end;
+        game->turn = (int)strtol(p, &end, 10);
+        p = end;
+    } else {
+        p = after_board;
+    }
+
+    return (int)(p - text);
+}
+
+/**
+ * @brief Chiffre d'une case au format texte
+ *
+ * @param piece Contenu de la case
+ * @return int Indice de la pièce dans PIECE_KINDS (0 si inconnue)
+ */
+static int position_digit(Piece piece) {
+    for (int kind = 0; kind < PIECE_KIND_COUNT; kind++) {
+        if (PIECE_KINDS[kind] == piece) return kind;
+    }
+    return 0;
+}
+
+/**
+ * @brief Écrit la position d'une partie
+ *
+ * @param game Partie à décrire
+ * @param buffer Tampon de sortie
+ * @param size Taille du tampon
+ * @return void
+ */
+void position_format(const Game *game, char *buffer, size_t size) {
+    char board[GRID_SIZE * (GRID_SIZE + 1)];
+    int n = 0;
+
+    for (int row = 0; row < GRID_SIZE; row++) {
+        if (row > 0) board[n++] = '/';
+        for (int col = 0; col < GRID_SIZE; col++) {
+            board[n++] = (char)('0' + position_digit(game->board[row][col]));
+        }
+    }
+    board[n] = '\0';
+
+    snprintf(buffer, size, "%s %d", board, game->turn);
+}
+
+/**
+ * @brief Charge les positions d'un fichier texte
+ *
+ * @param path Chemin du fichier
+ * @param entries Tableau de sortie
+ * @param max Nombre maximal de positions
+ * @return int Nombre de positions lues, -1 si le fichier ne peut être ouvert
+ */
+int position_load_file(const char *path, PositionEntry *entries, int max) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        LOG_ERROR_MSG("[POSITION] Impossible d'ouvrir %s", path);
+        return -1;
+    }
+
+    char line[256];
+    int count = 0;
+    int line_number = 0;
+
+    while (count < max && fgets(line, sizeof(line), file)) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        const char *p = line;
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0' || *p == '#') continue;
+
+        int length = position_parse(&entries[count].game, p);
+        if (length < 0) {
+            LOG_WARN_MSG("[POSITION] %s:%d : position invalide ignorée", path, line_number);
+            continue;
+        }
+
+        // Le reste de la ligne sert de libellé
+        p += length;
+        while (isspace((unsigned char)*p)) p++;
+        snprintf(entries[count].label, POSITION_LABEL_LEN, "%s", p);
+        count++;
+    }
+
+    fclose(file);
+    return count;
+}
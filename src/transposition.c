@@ -0,0 +1,201 @@
+/**
+ * @file transposition.c
+ * @brief Implémentation de la table de transposition
+ *
+ * Ce fichier contient la gestion de la table de transposition :
+ * - L'allocation d'une table de taille fixe (puissance de deux)
+ * - La consultation par clé Zobrist
+ * - L'enregistrement avec remplacement privilégiant la profondeur
+ * - Le codage des entrées pour un accès concurrent sans verrou
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "transposition.h"
+#include "logging.h"
+
+/**
+ * @struct tt_slot_t
+ * @brief Case de la table telle que stockée en mémoire (16 octets)
+ *
+ * data contient score (bits 0-31), profondeur (32-39), borne et génération
+ * (40-47), case de départ (48-55) et d'arrivée (56-63) du meilleur coup.
+ * check vaut clé ^ data : les deux mots étant lus et écrits séparément,
+ * une case en cours d'écriture par un autre thread échoue à la vérification.
+ */
+typedef struct {
+    uint64_t check;     /**< Clé Zobrist combinée par XOR avec data */
+    uint64_t data;      /**< Contenu de l'entrée */
+} tt_slot_t;
+
+/**
+ * @struct tt_t
+ * @brief État global de la table de transposition
+ */
+typedef struct {
+    tt_slot_t *entries; /**< Tableau des cases */
+    size_t mask;        /**< Nombre d'entrées - 1 (masque d'indexation) */
+    uint8_t generation; /**< Génération courante (6 bits utiles) */
+} tt_t;
+
+/** @brief Instance globale unique de la table */
+static tt_t g_tt = {0};
+
+/**
+ * @brief Alloue la table de transposition
+ *
+ * @param size_mb Taille en mégaoctets
+ * @return int 0 si succès, -1 si erreur
+ */
+int tt_init(size_t size_mb) {
+    tt_free();
+    if (size_mb == 0) return 0;
+
+    size_t max_entries = size_mb * 1024 * 1024 / sizeof(tt_slot_t);
+    size_t count = 1;
+    while (count * 2 <= max_entries) count *= 2;
+
+    g_tt.entries = calloc(count, sizeof(tt_slot_t));
+    if (!g_tt.entries) {
+        LOG_ERROR_MSG("[TT] Allocation de %zu Mo impossible", size_mb);
+        return -1;
+    }
+    g_tt.mask = count - 1;
+    g_tt.generation = 0;
+
+    LOG_INFO_MSG("[TT] Table de %zu entrées (%zu Mo)", count, count * sizeof(tt_slot_t) / (1024 * 1024));
+    return 0;
+}
+
+/**
+ * @brief Libère la table
+ *
+ * @return void
+ */
+void tt_free(void) {
+    free(g_tt.entries);
+    g_tt.entries = NULL;
+    g_tt.mask = 0;
+}
+
+/**
+ * @brief Vide la table
+ *
+ * @return void
+ */
+void tt_clear(void) {
+    if (g_tt.entries) memset(g_tt.entries, 0, (g_tt.mask + 1) * sizeof(tt_slot_t));
+}
+
+/**
+ * @brief Indique si la table est allouée
+ *
+ * @return int 1 si allouée, 0 sinon
+ */
+int tt_is_ready(void) {
+    return g_tt.entries != NULL;
+}
+
+/**
+ * @brief Passe à la génération suivante
+ *
+ * @return void
+ */
+void tt_new_search(void) {
+    g_tt.generation = (g_tt.generation + 1) & 0x3F;
+}
+
+/**
+ * @brief Code une entrée sur 64 bits
+ *
+ * @param entry Entrée à coder (la clé est ignorée)
+ * @return uint64_t Données de la case
+ */
+static inline uint64_t tt_pack(const TTEntry *entry) {
+    return (uint64_t)(uint32_t)entry->score
+         | (uint64_t)(uint8_t)entry->depth << 32
+         | (uint64_t)entry->bound_gen << 40
+         | (uint64_t)entry->best_from << 48
+         | (uint64_t)entry->best_to << 56;
+}
+
+/**
+ * @brief Décode les données d'une case
+ *
+ * @param key Clé de la position
+ * @param data Données de la case
+ * @param entry Entrée décodée
+ * @return void
+ */
+static inline void tt_unpack(uint64_t key, uint64_t data, TTEntry *entry) {
+    entry->key = key;
+    entry->score = (int32_t)(uint32_t)data;
+    entry->depth = (int8_t)(data >> 32);
+    entry->bound_gen = (uint8_t)(data >> 40);
+    entry->best_from = (uint8_t)(data >> 48);
+    entry->best_to = (uint8_t)(data >> 56);
+}
+
+/**
+ * @brief Cherche une position dans la table
+ *
+ * @param key Clé Zobrist
+ * @param entry Entrée trouvée
+ * @return int 1 si trouvée, 0 sinon
+ */
+int tt_probe(uint64_t key, TTEntry *entry) {
+    if (!g_tt.entries) return 0;
+
+    tt_slot_t *slot = &g_tt.entries[key & g_tt.mask];
+    uint64_t check = __atomic_load_n(&slot->check, __ATOMIC_RELAXED);
+    uint64_t data = __atomic_load_n(&slot->data, __ATOMIC_RELAXED);
+    if ((check ^ data) != key || (check | data) == 0) return 0;
+
+    tt_unpack(key, data, entry);
+    return 1;
+}
+
+/**
+ * @brief Enregistre le résultat d'une recherche
+ *
+ * L'entrée existante est remplacée si elle provient d'une recherche
+ * précédente ou si la nouvelle recherche est au moins aussi profonde.
+ * Une case illisible (écriture concurrente, case vide) est toujours remplacée.
+ *
+ * @param key Clé Zobrist
+ * @param depth Profondeur restante
+ * @param score Score obtenu
+ * @param bound Nature du score
+ * @param best_from Case de départ du meilleur coup
+ * @param best_to Case d'arrivée du meilleur coup
+ * @return void
+ */
+void tt_store(uint64_t key, int depth, int score, TTBound bound, int best_from, int best_to) {
+    if (!g_tt.entries) return;
+
+    tt_slot_t *slot = &g_tt.entries[key & g_tt.mask];
+    uint64_t old_check = __atomic_load_n(&slot->check, __ATOMIC_RELAXED);
+    uint64_t old_data = __atomic_load_n(&slot->data, __ATOMIC_RELAXED);
+
+    // Remplacement privilégiant la profondeur, les entrées périmées cèdent toujours
+    if ((old_check | old_data) != 0) {
+        TTEntry old;
+        tt_unpack(old_check ^ old_data, old_data, &old);
+        if ((old.bound_gen >> 2) == g_tt.generation && depth < old.depth) return;
+    }
+
+    TTEntry entry;
+    entry.score = score;
+    entry.depth = (int8_t)depth;
+    entry.bound_gen = (uint8_t)((g_tt.generation << 2) | bound);
+    entry.best_from = (uint8_t)best_from;
+    entry.best_to = (uint8_t)best_to;
+
+    uint64_t data = tt_pack(&entry);
+    __atomic_store_n(&slot->check, key ^ data, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->data, data, __ATOMIC_RELAXED);
+}
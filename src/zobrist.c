@@ -0,0 +1,30 @@
+/**
+ * @file zobrist.c
+ * @brief Implémentation du hachage Zobrist
+ *
+ * Ce fichier contient le calcul complet de la clé d'une position. Les clés
+ * sont produites à la compilation par tools/gen_tables.c (générateur
+ * splitmix64 à graine fixe, pour rester reproductibles).
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include "zobrist.h"
+
+/**
+ * @brief Calcule la clé complète d'une partie
+ *
+ * @param game Partie à hacher
+ * @return uint64_t Clé Zobrist
+ */
+uint64_t zobrist_hash(const Game *game) {
+    uint64_t key = 0;
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int col = 0; col < GRID_SIZE; col++) {
+            key ^= ZOBRIST_PIECES[row * GRID_SIZE + col][game->board[row][col]];
+        }
+    }
+    if (game->turn & 1) key ^= ZOBRIST_SIDE;
+    return key;
+}
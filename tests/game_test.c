@@ -73,7 +73,7 @@ int score_player_two(Game game) {
  * - Le déplacement est en ligne droite (horizontal ou vertical)
  * - Le chemin entre la source et la destination n'est pas bloqué
  */
-int is_move_legal(Game *game, int src_row, int src_col, int dst_row, int dst_col) {
+int is_move_legal(const Game *game, int src_row, int src_col, int dst_row, int dst_col) {
     if (src_row < 0 || src_row >= GRID_SIZE || src_col < 0 || src_col >= GRID_SIZE) return 0;
     if (dst_row < 0 || dst_row >= GRID_SIZE || dst_col < 0 || dst_col >= GRID_SIZE) return 0;
 
@@ -0,0 +1,111 @@
+/**
+ * @file test_ai_worker.c
+ * @brief Tests unitaires pour le thread de recherche de l'IA
+ *
+ * Ce fichier contient tous les tests unitaires pour le module ai_worker.c, incluant :
+ * - L'application du coup dans la boucle principale une fois la recherche terminée
+ * - L'absence de recherche en double pour un même tour
+ * - L'annulation d'une recherche en cours
+ * - L'arrêt du thread
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <gtk/gtk.h>
+
+#include "game.h"
+#include "algo.h"
+#include "ai_worker.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][AI_WORKER][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][AI_WORKER][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/**
+ * Traite les événements de la boucle principale jusqu'au changement de tour
+ */
+static void run_main_loop(Game *game, int turn, int timeout_s) {
+    time_t start = time(NULL);
+    while (game->turn == turn && time(NULL) - start < timeout_s) {
+        while (g_main_context_iteration(NULL, FALSE));
+        usleep(1000);
+    }
+}
+
+/**
+ * Partie locale où c'est au tour de l'IA (P2)
+ */
+static Game ai_turn_game(void) {
+    Game game = init_game(LOCAL, 0);
+    game.selected_tile[0] = 3;
+    game.selected_tile[1] = 0;
+    update_board(&game, 4, 0);
+    game.is_ai = 1;
+    return game;
+}
+
+/**
+ * Test de la remise du coup à la boucle principale
+ */
+void test_ai_worker_delivery() {
+    Game game = ai_turn_game();
+
+    ai_worker_request(&game);
+    ai_worker_request(&game); // Même tour : ignorée
+    TEST_ASSERT(ai_worker_busy(), "L'IA réfléchit après une demande");
+    TEST_ASSERT(game.turn == 1, "La demande ne bloque pas l'appelant");
+
+    run_main_loop(&game, 1, AI_TIME_BUDGET_MS / 1000 + 3);
+    TEST_ASSERT(game.turn == 2, "Le coup de l'IA est appliqué par la boucle principale");
+    TEST_ASSERT(!ai_worker_busy(), "L'IA est libre après application du coup");
+}
+
+/**
+ * Test de l'annulation d'une recherche
+ */
+void test_ai_worker_cancel() {
+    Game game = ai_turn_game();
+
+    ai_worker_request(&game);
+    usleep(100000);
+    ai_worker_cancel();
+    TEST_ASSERT(!ai_worker_busy(), "Aucune demande active après annulation");
+
+    run_main_loop(&game, 1, 1);
+    TEST_ASSERT(game.turn == 1, "Le coup d'une recherche annulée n'est pas appliqué");
+
+    ai_worker_shutdown();
+    TEST_ASSERT(1, "Arrêt du thread de l'IA");
+}
+
+/**
+ * Fonction principale des tests
+ */
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_ai_worker_delivery();
+    test_ai_worker_cancel();
+
+    LOG_INFO_MSG("[TEST][AI_WORKER][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
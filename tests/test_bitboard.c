@@ -0,0 +1,314 @@
+/**
+ * @file test_bitboard.c
+ * @brief Tests unitaires pour le module bitboard
+ *
+ * Ce fichier contient tous les tests unitaires pour valider le module bitboard.c, incluant :
+ * - Les opérations élémentaires sur les bitboards
+ * - La conversion du plateau Game.board vers une position bitboard
+ * - La mise à jour des plans case par case et la lecture d'une case
+ * - L'équivalence du générateur bitboard avec all_possible_moves
+ * - Les masques de voisinage
+ * - L'équivalence du générateur de captures avec les captures de did_eat
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "game.h"
+#include "algo.h"
+#include "bitboard.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][BITBOARD][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][BITBOARD][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/**
+ * Compare le générateur bitboard au générateur mailbox de référence
+ */
+static int same_moves(Game *game, Player player) {
+    Move reference[10 * 16];
+    PackedMove generated[10 * 16];
+    BitboardPosition pos;
+
+    bitboard_from_game(&pos, game);
+    int n_ref = all_possible_moves(game, reference, player);
+    int n_gen = bitboard_generate_moves(&pos, player, generated);
+
+    if (n_ref != n_gen) return 0;
+    if (bitboard_count_moves(&pos, player) != n_ref) return 0;
+    for (int i = 0; i < n_ref; i++) {
+        if (move_pack(reference[i]) != generated[i]) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Compte les pièces d'un joueur sur le plateau
+ */
+static int count_pieces(const Game *game, Player player) {
+    int count = 0;
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int col = 0; col < GRID_SIZE; col++) {
+            if (get_player(game->board[row][col]) == player) count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Joue un coup sur une copie du plateau avec la règle de capture du jeu
+ */
+static void play_move(Game *game, Move move, Player player) {
+    Piece piece = game->board[move.src_row][move.src_col];
+    game->turn = (player == P1) ? 0 : 1;
+    game->board[move.dst_row][move.dst_col] = piece;
+    game->board[move.src_row][move.src_col] = (player == P1) ? P1_VISITED : P2_VISITED;
+
+    Direction direction;
+    if (move.dst_row != move.src_row) direction = (move.dst_row < move.src_row) ? DIR_TOP : DIR_DOWN;
+    else direction = (move.dst_col < move.src_col) ? DIR_LEFT : DIR_RIGHT;
+    did_eat(game, move.dst_row, move.dst_col, direction);
+}
+
+/**
+ * Compare le générateur de captures aux coups qui capturent une fois joués
+ */
+static int same_captures(Game *game, Player player) {
+    PackedMove all[10 * 16];
+    PackedMove reference[10 * 16];
+    PackedMove generated[10 * 16];
+    BitboardPosition pos;
+    Player opponent = (player == P1) ? P2 : P1;
+    int n_ref = 0;
+
+    bitboard_from_game(&pos, game);
+    int n_all = bitboard_generate_moves(&pos, player, all);
+    for (int i = 0; i < n_all; i++) {
+        Game copy = *game;
+        play_move(&copy, move_unpack(all[i]), player);
+        if (count_pieces(&copy, opponent) < count_pieces(game, opponent)) reference[n_ref++] = all[i];
+    }
+
+    int n_gen = bitboard_generate_captures(&pos, player, generated, 0);
+    if (n_ref != n_gen) return 0;
+    return memcmp(reference, generated, n_ref * sizeof(PackedMove)) == 0;
+}
+
+/**
+ * Test des opérations élémentaires
+ */
+void test_bitboard_operations() {
+    Bitboard b = {0, 0};
+
+    bb_set(&b, 0);
+    bb_set(&b, 63);
+    bb_set(&b, 64);
+    bb_set(&b, 80);
+
+    TEST_ASSERT(bb_popcount(b) == 4, "Quatre cases présentes");
+    TEST_ASSERT(bb_test(b, 63) && bb_test(b, 64), "Cases de part et d'autre des deux mots");
+    TEST_ASSERT(bb_lsb(b) == 0, "Plus petite case = 0");
+    TEST_ASSERT(bb_msb(b) == 80, "Plus grande case = 80");
+
+    bb_clear(&b, 0);
+    TEST_ASSERT(bb_pop_lsb(&b) == 63, "Extraction de la case 63");
+    TEST_ASSERT(bb_pop_msb(&b) == 80, "Extraction de la case 80");
+    TEST_ASSERT(bb_popcount(b) == 1 && bb_test(b, 64), "Seule la case 64 reste");
+}
+
+/**
+ * Test de la conversion du plateau initial
+ */
+void test_bitboard_from_game() {
+    Game game = init_game(LOCAL, 0);
+    BitboardPosition pos;
+    bitboard_from_game(&pos, &game);
+
+    TEST_ASSERT(bb_popcount(pos.pieces[0]) == 10, "10 pièces pour P1 au départ");
+    TEST_ASSERT(bb_popcount(pos.pieces[1]) == 10, "10 pièces pour P2 au départ");
+    TEST_ASSERT(bb_test(pos.kings, BB_SQUARE(1, 1)), "Roi P1 en B8");
+    TEST_ASSERT(bb_test(pos.kings, BB_SQUARE(7, 7)), "Roi P2 en H2");
+    TEST_ASSERT(bb_is_empty(pos.visited[0]) && bb_is_empty(pos.visited[1]), "Aucune case visitée");
+}
+
+/**
+ * Test de la mise à jour d'une case
+ */
+void test_bitboard_put() {
+    Game game = init_game(LOCAL, 0);
+    BitboardPosition pos;
+    bitboard_from_game(&pos, &game);
+
+    bitboard_put(&pos, BB_SQUARE(1, 1), P1_VISITED);
+    TEST_ASSERT(!bb_test(pos.pieces[0], BB_SQUARE(1, 1)), "Roi retiré de l'occupation P1");
+    TEST_ASSERT(!bb_test(pos.kings, BB_SQUARE(1, 1)), "Roi retiré du plan des rois");
+    TEST_ASSERT(bb_test(pos.visited[0], BB_SQUARE(1, 1)), "Case marquée visitée par P1");
+
+    bitboard_put(&pos, BB_SQUARE(1, 1), P2_KING);
+    TEST_ASSERT(bb_test(pos.pieces[1], BB_SQUARE(1, 1)), "Roi P2 ajouté à l'occupation P2");
+    TEST_ASSERT(!bb_test(pos.visited[0], BB_SQUARE(1, 1)), "Marque de visite effacée");
+
+    // Chaque contenu de case relu tel qu'il a été écrit
+    Piece kinds[] = {P_NONE, P1_PAWN, P2_PAWN, P1_KING, P2_KING, P1_VISITED, P2_VISITED};
+    int same = 1;
+    for (int i = 0; i < (int)(sizeof(kinds) / sizeof(kinds[0])); i++) {
+        bitboard_put(&pos, BB_SQUARE(4, 4), kinds[i]);
+        same = same && bitboard_piece_at(&pos, BB_SQUARE(4, 4)) == kinds[i];
+    }
+    TEST_ASSERT(same, "Contenu de case relu par bitboard_piece_at");
+}
+
+/**
+ * Test d'équivalence avec le générateur de référence
+ */
+void test_bitboard_generation() {
+    Game game = init_game(LOCAL, 0);
+
+    TEST_ASSERT(same_moves(&game, P1), "Coups P1 identiques au plateau initial");
+    TEST_ASSERT(same_moves(&game, P2), "Coups P2 identiques au plateau initial");
+
+    // Les cases visitées ne bloquent pas les déplacements
+    game.board[4][0] = P1_VISITED;
+    game.board[4][4] = P2_VISITED;
+    game.board[4][8] = P2_PAWN;
+    TEST_ASSERT(same_moves(&game, P1), "Coups P1 identiques avec cases visitées");
+    TEST_ASSERT(same_moves(&game, P2), "Coups P2 identiques avec cases visitées");
+
+    // Pièce isolée en coin : 16 destinations
+    Game corner = init_game(LOCAL, 0);
+    memset(corner.board, 0, sizeof(corner.board));
+    corner.board[8][8] = P1_KING;
+    BitboardPosition pos;
+    bitboard_from_game(&pos, &corner);
+    TEST_ASSERT(bitboard_count_moves(&pos, P1) == 16, "Roi seul en coin : 16 coups");
+    TEST_ASSERT(same_moves(&corner, P1), "Coups identiques pour une pièce isolée");
+}
+
+/**
+ * Test des masques de voisinage
+ */
+void test_bitboard_neighbours() {
+    TEST_ASSERT(bb_popcount(BB_ADJACENT[BB_SQUARE(0, 0)]) == 2, "Coin : 2 cases adjacentes");
+    TEST_ASSERT(bb_popcount(BB_ADJACENT[BB_SQUARE(4, 4)]) == 4, "Centre : 4 cases adjacentes");
+    TEST_ASSERT(bb_popcount(BB_SURROUNDING[BB_SQUARE(0, 8)]) == 3, "Coin : 3 voisins");
+    TEST_ASSERT(bb_popcount(BB_SURROUNDING[BB_SQUARE(4, 0)]) == 5, "Bord : 5 voisins");
+    TEST_ASSERT(bb_test(BB_SURROUNDING[BB_SQUARE(4, 4)], BB_SQUARE(5, 5)), "Diagonale incluse dans le voisinage");
+    TEST_ASSERT(!bb_test(BB_ADJACENT[BB_SQUARE(4, 4)], BB_SQUARE(5, 5)), "Diagonale exclue des cases adjacentes");
+    TEST_ASSERT(!bb_test(BB_ADJACENT[BB_SQUARE(3, 8)], BB_SQUARE(4, 0)), "Pas de voisin par débordement de ligne");
+    TEST_ASSERT(BB_NEIGHBOUR[BB_SQUARE(0, 8)][DIR_TOP] == -1 && BB_NEIGHBOUR[BB_SQUARE(0, 8)][DIR_RIGHT] == -1,
+                "Coin : pas de voisin hors plateau");
+    TEST_ASSERT(BB_NEIGHBOUR[BB_SQUARE(3, 8)][DIR_RIGHT] == -1 && BB_NEIGHBOUR[BB_SQUARE(4, 0)][DIR_LEFT] == -1,
+                "Pas de voisin par débordement de ligne dans la table des directions");
+    TEST_ASSERT(BB_NEIGHBOUR[BB_SQUARE(4, 4)][DIR_DOWN] == BB_SQUARE(5, 4), "Voisin du bas");
+}
+
+/**
+ * Test du générateur de captures
+ */
+void test_bitboard_captures() {
+    Game game = init_game(LOCAL, 0);
+    memset(game.board, 0, sizeof(game.board));
+    game.board[4][4] = P2_PAWN;
+    game.board[4][5] = P1_PAWN;
+    game.board[2][3] = P1_PAWN;
+    game.board[4][0] = P1_KING;
+    game.board[0][6] = P2_KING;
+
+    PackedMove list[10 * 16];
+    BitboardPosition pos;
+    bitboard_from_game(&pos, &game);
+    int size = bitboard_generate_captures(&pos, P1, list, 0);
+    TEST_ASSERT(size == 2, "Sandwich et sprint sur le même pion");
+    TEST_ASSERT(size == 2 && list[1] == packed_move(BB_SQUARE(4, 0), BB_SQUARE(4, 3)), "Sprint du roi contre le pion");
+    TEST_ASSERT(same_captures(&game, P1), "Captures identiques à did_eat");
+
+    // Le pion (4,5) peut monter au contact du roi adverse en (0,5) sans rien capturer
+    size = bitboard_generate_captures(&pos, P1, list, 1);
+    TEST_ASSERT(size == 3 && packed_to(list[2]) == BB_SQUARE(0, 5), "Menaces sur le roi ajoutées sur demande");
+
+    // Parties aléatoires : toutes les positions traversées sont comparées
+    srand(2526);
+    int identical = 1;
+    for (int g = 0; g < 40 && identical; g++) {
+        Game random_game = init_game(LOCAL, 0);
+        for (int ply = 0; ply < 60; ply++) {
+            Player player = (ply % 2 == 0) ? P1 : P2;
+            identical = identical && same_captures(&random_game, P1) && same_captures(&random_game, P2);
+
+            Move moves[10 * 16];
+            int n = all_possible_moves(&random_game, moves, player);
+            if (n == 0 || count_pieces(&random_game, P1) <= 2 || count_pieces(&random_game, P2) <= 2) break;
+            play_move(&random_game, moves[rand() % n], player);
+        }
+    }
+    TEST_ASSERT(identical, "Captures identiques sur des parties aléatoires");
+}
+
+/**
+ * Fonction principale des tests
+ */
+/**
+ * Test du codage des coups sur 16 bits et de la notation réseau
+ */
+void test_packed_moves() {
+    int round_trip = 1;
+    for (int from = 0; from < BB_SQUARES; from++) {
+        for (int to = 0; to < BB_SQUARES; to++) {
+            if (from == to) continue;
+            PackedMove move = packed_move(from, to);
+            if (move == PACKED_MOVE_NONE || packed_from(move) != from || packed_to(move) != to) round_trip = 0;
+            if (move_pack(move_unpack(move)) != move) round_trip = 0;
+        }
+    }
+    TEST_ASSERT(round_trip, "Codage réversible pour toutes les cases");
+    TEST_ASSERT(sizeof(PackedMove) == 2, "Coup codé sur 16 bits");
+
+    PackedMove flagged = packed_move(BB_SQUARE(8, 0), BB_SQUARE(8, 8)) | MOVE_FLAG_CAPTURE;
+    TEST_ASSERT(packed_to(flagged) == BB_SQUARE(8, 8) && packed_same(flagged, packed_move(BB_SQUARE(8, 0), BB_SQUARE(8, 8))),
+                "Le drapeau ne modifie pas les cases");
+    TEST_ASSERT(move_unpack(PACKED_MOVE_NONE).src_row == -1, "Absence de coup décodée en coordonnées -1");
+
+    Move move = {8, 3, 8, 7, -1};
+    char notation[5];
+    move_to_notation(move, notation);
+    TEST_ASSERT(strcmp(notation, "D1H1") == 0, "Notation réseau du coup (8,3) -> (8,7)");
+
+    Move parsed;
+    TEST_ASSERT(move_from_notation("A9B2", &parsed) == 0 && parsed.src_row == 0 && parsed.src_col == 0 &&
+                parsed.dst_row == 7 && parsed.dst_col == 1, "Lecture de la notation réseau");
+    TEST_ASSERT(move_from_notation("J1A1", &parsed) < 0 && move_from_notation("A0A1", &parsed) < 0 &&
+                move_from_notation("A1", &parsed) < 0, "Notations hors plateau refusées");
+}
+
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_bitboard_operations();
+    test_bitboard_from_game();
+    test_bitboard_put();
+    test_bitboard_generation();
+    test_bitboard_neighbours();
+    test_bitboard_captures();
+    test_packed_moves();
+
+    LOG_INFO_MSG("[TEST][BITBOARD][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
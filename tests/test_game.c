@@ -66,6 +66,8 @@ void test_scoring() {
 
     TEST_ASSERT(score_p1 > 0, "Score du joueur 1 est positif");
     TEST_ASSERT(score_p2 > 0, "Score du joueur 2 est positif");
+    TEST_ASSERT(player_score(&game, P1) == score_p1 && player_score(&game, P2) == score_p2,
+                "player_score identique aux scores par valeur");
 }
 
 /**
@@ -204,6 +206,7 @@ void test_victory_conditions() {
         }
     }
 
+    TEST_ASSERT(compute_winner(&game) == P1 && game.won == NOT_PLAYER, "compute_winner ne modifie pas la partie");
     won(&game);
     TEST_ASSERT(game.won == P1, "P1 remporte la victoire");
 }
@@ -0,0 +1,154 @@
+/**
+ * @file test_mailbox.c
+ * @brief Tests unitaires pour le module mailbox
+ *
+ * Ce fichier contient tous les tests unitaires pour valider le module mailbox.c, incluant :
+ * - La conversion du plateau Game.board vers le plateau bordé
+ * - L'anneau de sentinelles et le comptage des voisins
+ * - La règle de capture au centre et au bord du plateau
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "game.h"
+#include "mailbox.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][MAILBOX][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][MAILBOX][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/**
+ * Crée une partie au plateau vide
+ */
+static Game empty_game(void) {
+    Game game = init_game(LOCAL, 0);
+    memset(game.board, P_NONE, sizeof(game.board));
+    return game;
+}
+
+/**
+ * Test de la conversion et de l'anneau de sentinelles
+ */
+void test_mailbox_from_game() {
+    Game game = init_game(LOCAL, 0);
+    Mailbox mb;
+    int same = 1;
+    int ring = 1;
+
+    mailbox_from_game(&mb, &game);
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int col = 0; col < GRID_SIZE; col++) {
+            if (mb.cells[MB_SQUARE(row, col)] != game.board[row][col]) same = 0;
+            if (MB_ROW(MB_SQUARE(row, col)) != row || MB_COL(MB_SQUARE(row, col)) != col) same = 0;
+        }
+    }
+    for (int i = 0; i < MB_SIZE; i++) {
+        if (mb.cells[i] != MB_OFFBOARD || mb.cells[MB_SQUARES - 1 - i] != MB_OFFBOARD) ring = 0;
+        if (mb.cells[i * MB_SIZE] != MB_OFFBOARD || mb.cells[i * MB_SIZE + MB_SIZE - 1] != MB_OFFBOARD) ring = 0;
+    }
+
+    TEST_ASSERT(same, "Plateau recopié à l'intérieur de l'anneau");
+    TEST_ASSERT(ring, "Anneau de sentinelles complet");
+    TEST_ASSERT(piece_owner(MB_OFFBOARD) == NOT_PLAYER, "Sentinelle sans propriétaire");
+}
+
+/**
+ * Test du comptage des voisins
+ */
+void test_mailbox_neighbours() {
+    Game game = init_game(LOCAL, 0);
+    Mailbox mb;
+
+    mailbox_from_game(&mb, &game);
+    // Roi P1 en (1, 1) : pions en (0, 2), (1, 2), (2, 0), (2, 1), (2, 2)
+    TEST_ASSERT(mailbox_adjacent(&mb, MB_SQUARE(1, 1), P1) == 2, "Deux alliés orthogonaux du roi P1");
+    TEST_ASSERT(mailbox_surrounding(&mb, MB_SQUARE(1, 1), P1) == 5, "Cinq alliés autour du roi P1");
+    TEST_ASSERT(mailbox_surrounding(&mb, MB_SQUARE(0, 0), P1) == 1, "Coin : seuls les voisins sur le plateau comptent");
+    TEST_ASSERT(mailbox_adjacent(&mb, MB_SQUARE(8, 6), P2) == 2, "Bord : la sentinelle ne compte pour aucun joueur");
+}
+
+/**
+ * Test de la règle de capture
+ */
+void test_mailbox_captures() {
+    Game game = empty_game();
+    Mailbox mb;
+    int captured[4];
+
+    // Sandwich au centre
+    game.board[4][4] = P1_PAWN;
+    game.board[4][5] = P2_PAWN;
+    game.board[4][6] = P1_PAWN;
+    mailbox_from_game(&mb, &game);
+    int count = mailbox_captures(&mb, MB_SQUARE(4, 4), DIR_TOP, P1, captured);
+    TEST_ASSERT(count == 1 && captured[0] == MB_SQUARE(4, 5), "Capture en sandwich");
+
+    // Sprint contre le bord : la sentinelle ne protège pas
+    game = empty_game();
+    game.board[1][4] = P1_PAWN;
+    game.board[0][4] = P2_PAWN;
+    mailbox_from_game(&mb, &game);
+    count = mailbox_captures(&mb, MB_SQUARE(1, 4), DIR_TOP, P1, captured);
+    TEST_ASSERT(count == 1 && captured[0] == MB_SQUARE(0, 4), "Capture par sprint contre le bord");
+    count = mailbox_captures(&mb, MB_SQUARE(1, 4), DIR_LEFT, P1, captured);
+    TEST_ASSERT(count == 0, "Pas de capture hors de la direction du sprint");
+
+    // Sprint bloqué par un allié de la pièce visée
+    game.board[2][4] = P1_PAWN;
+    game.board[1][4] = P2_PAWN;
+    mailbox_from_game(&mb, &game);
+    count = mailbox_captures(&mb, MB_SQUARE(2, 4), DIR_TOP, P1, captured);
+    TEST_ASSERT(count == 0, "Sprint bloqué par un allié adverse");
+
+    // Captures multiples, dans l'ordre de Direction
+    game = empty_game();
+    game.board[4][4] = P2_KING;
+    game.board[3][4] = P1_PAWN;
+    game.board[2][4] = P2_PAWN;
+    game.board[4][3] = P1_PAWN;
+    game.board[4][2] = P2_PAWN;
+    game.board[5][4] = P1_PAWN;
+    game.board[6][4] = P2_PAWN;
+    mailbox_from_game(&mb, &game);
+    count = mailbox_captures(&mb, MB_SQUARE(4, 4), DIR_LEFT, P2, captured);
+    TEST_ASSERT(count == 3 && captured[0] == MB_SQUARE(3, 4) && captured[1] == MB_SQUARE(5, 4) &&
+                captured[2] == MB_SQUARE(4, 3), "Trois captures en sandwich");
+
+    // did_eat applique la même règle sur Game.board
+    game.turn = 1;
+    did_eat(&game, 4, 4, DIR_LEFT);
+    TEST_ASSERT(game.board[3][4] == P_NONE && game.board[5][4] == P_NONE && game.board[4][3] == P_NONE,
+                "did_eat retire les pièces capturées");
+}
+
+/**
+ * Fonction principale des tests
+ */
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_mailbox_from_game();
+    test_mailbox_neighbours();
+    test_mailbox_captures();
+
+    LOG_INFO_MSG("[TEST][MAILBOX][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
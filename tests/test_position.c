@@ -0,0 +1,99 @@
+/**
+ * @file test_position.c
+ * @brief Tests unitaires pour le module position et le comptage perft
+ *
+ * Ce fichier contient tous les tests unitaires pour valider le module position.c, incluant :
+ * - La lecture et l'écriture d'une position texte
+ * - Le rejet des positions invalides
+ * - L'accord de perft() avec le générateur mailbox de référence
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "game.h"
+#include "algo.h"
+#include "position.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][POSITION][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][POSITION][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/** Position de départ au format texte */
+static const char *START = "001100000/031100000/111000000/110000000/000000000/000000022/000000222/000002240/000002200 0";
+
+/**
+ * Test de lecture et d'écriture
+ */
+void test_position_round_trip() {
+    Game game;
+    Game start = init_game(LOCAL, 0);
+    char text[POSITION_MAX_LEN];
+
+    int length = position_parse(&game, START);
+    TEST_ASSERT(length == (int)strlen(START), "Position de départ lue en entier");
+    TEST_ASSERT(memcmp(game.board, start.board, sizeof(game.board)) == 0, "Plateau identique à STARTING_BOARD");
+
+    position_format(&start, text, sizeof(text));
+    TEST_ASSERT(strcmp(text, START) == 0, "Écriture de la position de départ");
+
+    position_parse(&game, "000000000/000000000/000000000/000000000/000030000/000000000/000000000/000000000/000000004 17 fin");
+    TEST_ASSERT(game.turn == 17 && game.board[4][4] == P1_KING, "Tour et pièce lus");
+}
+
+/**
+ * Test des positions invalides
+ */
+void test_position_invalid() {
+    Game game;
+
+    TEST_ASSERT(position_parse(&game, "001100000/031100000") < 0, "Plateau incomplet refusé");
+    TEST_ASSERT(position_parse(&game, "001100000/031100000/111000000/110000000/000000000/000000022/000000222/000002290/000002200") < 0,
+                "Pièce inconnue refusée");
+}
+
+/**
+ * Test de l'accord de perft avec la référence
+ */
+void test_position_perft() {
+    Game game = init_game(LOCAL, 0);
+
+    TEST_ASSERT(perft(&game, 1) == 52, "52 coups au plateau de départ");
+    TEST_ASSERT(perft(&game, 3) == perft_reference(&game, 3), "Perft identique à la référence en profondeur 3");
+
+    Game copy = game;
+    perft(&game, 3);
+    TEST_ASSERT(memcmp(copy.board, game.board, sizeof(game.board)) == 0 && copy.turn == game.turn,
+                "Partie restaurée après perft");
+}
+
+/**
+ * Fonction principale des tests
+ */
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_position_round_trip();
+    test_position_invalid();
+    test_position_perft();
+
+    LOG_INFO_MSG("[TEST][POSITION][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
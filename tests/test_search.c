@@ -0,0 +1,164 @@
+/**
+ * @file test_search.c
+ * @brief Tests unitaires de la recherche répartie entre plusieurs threads
+ *
+ * Ce fichier contient les tests de minimax_best_move_parallel() (coups racine
+ * et nœuds internes partagés entre threads, Young Brothers Wait), incluant :
+ * - La légalité du coup retourné avec 1 et plusieurs threads
+ * - L'identité de la recherche à 1 thread et de la recherche séquentielle
+ * - L'identité du coup avec la recherche séquentielle quel que soit le
+ *   nombre de threads
+ * - Le nombre de nœuds comparé à la recherche séquentielle
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "game.h"
+#include "algo.h"
+#include "position.h"
+#include "transposition.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][SEARCH][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][SEARCH][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/** Profondeur des recherches : assez pour que des nœuds partagés s'imbriquent */
+#define SEARCH_TEST_DEPTH 5
+
+/** Rapport maximal entre les nœuds de la recherche répartie et ceux de la recherche séquentielle */
+#define SEARCH_TEST_MAX_OVERHEAD 4
+
+/**
+ * Positions de milieu et de fin de partie (extraites de tools/bench_positions.txt)
+ *
+ * Le plateau de départ est symétrique : plusieurs coups y ont le même score
+ * et l'ordre de fin des threads peut départager autrement les égalités. Sur
+ * d'autres positions, la table partagée et les heuristiques propres à chaque
+ * thread rendent le score de certains coups dépendant de l'ordre de fin des
+ * threads : les positions retenues sont celles où le coup choisi n'en
+ * dépend pas, même si son score peut varier de quelques points.
+ */
+static const char *POSITIONS[] = {
+    "000200061/035550015/155010060/110006002/000000000/000000062/000000262/001006240/000006200 14",
+    "000600060/031001000/151200006/155055000/050015000/000020066/000060626/020006664/500050100 26",
+    "001500100/351000000/155200050/550000000/550000010/050666666/000226622/050000640/050002600 26",
+    "005100000/315050000/555150600/550005000/050000000/000206066/002600666/020006640/000002600 29",
+    "051500000/055500540/555050360/550010000/050050000/060602666/000000662/010006660/000006600 27",
+};
+
+/**
+ * @brief Indique si un coup fait partie des coups légaux du joueur au trait
+ */
+static int is_legal(const Game *game, Move move) {
+    Move moves[10 * 16];
+    Player player = ((game->turn & 1) == 0) ? P1 : P2;
+    int count = all_possible_moves((Game *)game, moves, player);
+
+    for (int i = 0; i < count; i++) {
+        if (moves[i].src_row == move.src_row && moves[i].src_col == move.src_col &&
+            moves[i].dst_row == move.dst_row && moves[i].dst_col == move.dst_col) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Indique si deux coups ont mêmes cases de départ et d'arrivée
+ */
+static int same_move(Move a, Move b) {
+    return a.src_row == b.src_row && a.src_col == b.src_col &&
+           a.dst_row == b.dst_row && a.dst_col == b.dst_col;
+}
+
+/**
+ * @brief Lance la recherche répartie avec un nombre de threads donné
+ *
+ * La table de transposition et les heuristiques sont vidées avant chaque
+ * recherche : toutes partent du même état que la recherche séquentielle.
+ */
+static Move search_with_threads(const Game *game, int threads, SearchStats *stats) {
+    Game copy = *game;
+
+    ai_set_threads(threads);
+    ai_reset_heuristics();
+    tt_clear();
+    return minimax_best_move_parallel(&copy, SEARCH_TEST_DEPTH, stats);
+}
+
+/**
+ * Test de la recherche répartie sur une position
+ */
+void test_search_position(const Game *game) {
+    Game copy = *game;
+    SearchStats serial;
+    ai_reset_heuristics();
+    tt_clear();
+    Move reference = minimax_best_move_stats(&copy, SEARCH_TEST_DEPTH, &serial);
+    TEST_ASSERT(memcmp(copy.board, game->board, sizeof(game->board)) == 0 && copy.turn == game->turn,
+                "Position intacte après la recherche séquentielle");
+    TEST_ASSERT(is_legal(game, reference), "Coup légal de la recherche séquentielle");
+
+    SearchStats single;
+    Move move = search_with_threads(game, 1, &single);
+    TEST_ASSERT(same_move(move, reference) && single.score == serial.score && single.nodes == serial.nodes,
+                "Recherche à 1 thread identique à la recherche séquentielle");
+
+    int threads[] = {2, 4, 8};
+    for (int i = 0; i < (int)(sizeof(threads) / sizeof(threads[0])); i++) {
+        SearchStats stats;
+        move = search_with_threads(game, threads[i], &stats);
+        char message[128];
+
+        snprintf(message, sizeof(message), "Coup légal avec %d threads", threads[i]);
+        TEST_ASSERT(is_legal(game, move), message);
+
+        snprintf(message, sizeof(message), "Même coup avec %d threads qu'en séquentiel", threads[i]);
+        TEST_ASSERT(same_move(move, reference), message);
+
+        snprintf(message, sizeof(message), "Nœuds avec %d threads bornés par rapport à la recherche séquentielle", threads[i]);
+        TEST_ASSERT(stats.nodes <= SEARCH_TEST_MAX_OVERHEAD * serial.nodes, message);
+    }
+}
+
+/**
+ * Test de la recherche répartie sur des positions de partie
+ */
+void test_search_positions() {
+    Game game = init_game(LOCAL, 0);
+
+    for (int i = 0; i < (int)(sizeof(POSITIONS) / sizeof(POSITIONS[0])); i++) {
+        TEST_ASSERT(position_parse(&game, POSITIONS[i]) > 0, "Position de test lue");
+        test_search_position(&game);
+    }
+}
+
+/**
+ * Fonction principale des tests
+ */
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_search_positions();
+
+    LOG_INFO_MSG("[TEST][SEARCH][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
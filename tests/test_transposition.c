@@ -0,0 +1,167 @@
+/**
+ * @file test_transposition.c
+ * @brief Tests unitaires pour le hachage Zobrist et la table de transposition
+ *
+ * Ce fichier contient tous les tests unitaires pour les modules zobrist.c et transposition.c, incluant :
+ * - La reproductibilité des clés Zobrist
+ * - La prise en compte du joueur au trait et des cases visitées
+ * - L'enregistrement et la consultation d'entrées
+ * - La politique de remplacement privilégiant la profondeur
+ * - La cohérence des entrées lues pendant des écritures concurrentes
+ *
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "game.h"
+#include "zobrist.h"
+#include "transposition.h"
+#include "logging.h"
+#include "const.h"
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            LOG_SUCCESS_MSG("[TEST][TT][OK] %s", message); \
+            tests_passed++; \
+        } else { \
+            LOG_ERROR_MSG("[TEST][TT][KO] %s", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/**
+ * Test des clés Zobrist
+ */
+void test_zobrist_keys() {
+    Game game = init_game(LOCAL, 0);
+    uint64_t initial = zobrist_hash(&game);
+
+    TEST_ASSERT(initial == zobrist_hash(&game), "Clé identique pour une même position");
+
+    game.turn = 1;
+    TEST_ASSERT(zobrist_hash(&game) == (initial ^ ZOBRIST_SIDE), "Le joueur au trait modifie la clé");
+    game.turn = 0;
+
+    game.board[4][4] = P1_VISITED;
+    uint64_t visited_p1 = zobrist_hash(&game);
+    game.board[4][4] = P2_VISITED;
+    uint64_t visited_p2 = zobrist_hash(&game);
+    TEST_ASSERT(visited_p1 != initial, "Une case visitée modifie la clé");
+    TEST_ASSERT(visited_p1 != visited_p2, "Les visites P1 et P2 ont des clés distinctes");
+}
+
+/**
+ * Test de l'enregistrement et de la consultation
+ */
+void test_tt_store_probe() {
+    TEST_ASSERT(tt_init(1) == 0, "Allocation d'une table de 1 Mo");
+    TEST_ASSERT(tt_is_ready(), "Table utilisable après allocation");
+
+    TTEntry entry;
+    TEST_ASSERT(!tt_probe(0x1234, &entry), "Position absente d'une table vide");
+
+    tt_store(0x1234, 3, 150, TT_LOWER, 10, 19);
+    TEST_ASSERT(tt_probe(0x1234, &entry), "Position trouvée après enregistrement");
+    TEST_ASSERT(entry.score == 150 && entry.depth == 3, "Score et profondeur conservés");
+    TEST_ASSERT(tt_entry_bound(&entry) == TT_LOWER, "Nature de borne conservée");
+    TEST_ASSERT(entry.best_from == 10 && entry.best_to == 19, "Meilleur coup conservé");
+
+    tt_clear();
+    TEST_ASSERT(!tt_probe(0x1234, &entry), "Table vide après effacement");
+    tt_free();
+    TEST_ASSERT(!tt_is_ready(), "Table inutilisable après libération");
+}
+
+/**
+ * Test du remplacement privilégiant la profondeur
+ */
+void test_tt_replacement() {
+    tt_init(1);
+    TTEntry entry;
+
+    tt_store(0x42, 5, 10, TT_EXACT, TT_NO_SQUARE, TT_NO_SQUARE);
+    tt_store(0x42, 2, 20, TT_EXACT, TT_NO_SQUARE, TT_NO_SQUARE);
+    tt_probe(0x42, &entry);
+    TEST_ASSERT(entry.depth == 5 && entry.score == 10, "Une recherche moins profonde ne remplace pas");
+
+    tt_store(0x42, 6, 30, TT_UPPER, TT_NO_SQUARE, TT_NO_SQUARE);
+    tt_probe(0x42, &entry);
+    TEST_ASSERT(entry.depth == 6 && entry.score == 30, "Une recherche plus profonde remplace");
+
+    tt_new_search();
+    tt_store(0x42, 1, 40, TT_EXACT, TT_NO_SQUARE, TT_NO_SQUARE);
+    tt_probe(0x42, &entry);
+    TEST_ASSERT(entry.depth == 1 && entry.score == 40, "Une entrée d'une recherche précédente est remplacée");
+
+    tt_free();
+}
+
+/**
+ * Thread écrivant et relisant des entrées dont le score se déduit de la clé
+ */
+static void *tt_stress_thread(void *arg) {
+    uint64_t seed = (uint64_t)(size_t)arg;
+    long *inconsistent = malloc(sizeof(long));
+    *inconsistent = 0;
+
+    for (int i = 0; i < 200000; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t key = seed | 1;
+        tt_store(key, (int)(key % 20), (int32_t)(key >> 40), TT_EXACT, (int)(key % 81), (int)(key % 79));
+
+        TTEntry entry;
+        if (tt_probe(key, &entry)) {
+            if (entry.score != (int32_t)(key >> 40) || entry.best_from != key % 81 || entry.best_to != key % 79) {
+                (*inconsistent)++;
+            }
+        }
+    }
+    return inconsistent;
+}
+
+/**
+ * Test de la table partagée entre plusieurs threads
+ */
+void test_tt_concurrent() {
+    tt_init(1);
+    pthread_t threads[4];
+    long inconsistent = 0;
+
+    for (long t = 0; t < 4; t++) {
+        pthread_create(&threads[t], NULL, tt_stress_thread, (void *)(t + 1));
+    }
+    for (int t = 0; t < 4; t++) {
+        long *result;
+        pthread_join(threads[t], (void **)&result);
+        inconsistent += *result;
+        free(result);
+    }
+    TEST_ASSERT(inconsistent == 0, "Aucune entrée incohérente lue pendant des écritures concurrentes");
+
+    tt_free();
+}
+
+/**
+ * Fonction principale des tests
+ */
+int main() {
+    if (logger_init("./logs/test.log", LOG_DEBUG) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    test_zobrist_keys();
+    test_tt_store_probe();
+    test_tt_replacement();
+    test_tt_concurrent();
+
+    LOG_INFO_MSG("[TEST][TT][RESULT] %d/%d", tests_passed, tests_passed + tests_failed);
+}
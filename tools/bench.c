@@ -0,0 +1,182 @@
+/**
+ * @file bench.c
+ * @brief Benchmark de la recherche de l'IA
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Programme sans interface graphique qui lance minimax_best_move_stats() sur
+ * un ensemble fixe de positions de milieu et de fin de partie, profondeur par
+ * profondeur. Pour chaque profondeur sont affichés :
+ * - le nombre de nœuds (quiescence comprise) et le débit en nœuds par seconde
+ * - le facteur de branchement effectif (nœuds / nœuds de la profondeur précédente)
+ * - le taux de coupure alpha-bêta et la part des coupures dès le premier coup
+ * - le temps de la recherche et le temps cumulé pour atteindre cette profondeur
+ *
+ * La recherche est mono-thread ; la table de transposition et les heuristiques
+ * de tri sont vidées avant chaque position : le nombre total de nœuds ne dépend que du code et sert de
+ * signature, affichée en fin de programme. Deux compilations qui donnent la
+ * même signature explorent exactement le même arbre.
+ *
+ * Avec -t, la recherche est répartie entre le nombre de threads demandé
+ * (minimax_best_move_parallel()). Le nombre de nœuds dépend alors de
+ * l'ordonnancement des threads et ne sert plus de signature. La somme de
+ * contrôle « Coups » des coups et des scores retenus, affichée en fin de
+ * programme, se compare à celle de la recherche mono-thread : un écart
+ * désigne une position où la recherche répartie a choisi autrement.
+ *
+ * Utilisation :
+ *   ./bench [-d <profondeur>] [-f <fichier>] [-t <threads>]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "game.h"
+#include "algo.h"
+#include "position.h"
+#include "transposition.h"
+#include "logging.h"
+#include "const.h"
+
+/** @brief Nombre maximal de positions du benchmark */
+#define BENCH_MAX_POSITIONS 64
+
+/** @brief Profondeur par défaut (paramètre de minimax_best_move) */
+#define BENCH_DEFAULT_DEPTH 4
+
+/** @brief Fichier de positions par défaut */
+#define BENCH_DEFAULT_FILE "tools/bench_positions.txt"
+
+/**
+ * @brief Temps écoulé sur l'horloge monotone
+ *
+ * @return double Temps courant en secondes
+ */
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Pourcentage sans division par zéro
+ */
+static double percent(unsigned long part, unsigned long total) {
+    return total ? 100.0 * part / total : 0;
+}
+
+/**
+ * @brief Ajoute un coup et son score à une somme de contrôle
+ *
+ * @param checksum Somme de contrôle courante
+ * @param move Coup retenu par la recherche
+ * @param score Score du coup
+ * @return unsigned long Nouvelle somme de contrôle
+ */
+static unsigned long checksum_add(unsigned long checksum, Move move, int score) {
+    unsigned long square = (unsigned long)(move.src_row * GRID_SIZE + move.src_col) * GRID_SIZE * GRID_SIZE
+                         + (unsigned long)(move.dst_row * GRID_SIZE + move.dst_col);
+    return checksum * 31 + square * 65536 + (unsigned long)(score & 0xFFFF);
+}
+
+/**
+ * @brief Point d'entrée du benchmark
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Arguments de la ligne de commande
+ * @return int 0 en cas de succès, 1 en cas d'erreur
+ */
+int main(int argc, char *argv[]) {
+    if (logger_init("./logs/bench.log", LOG_INFO) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    const char *path = BENCH_DEFAULT_FILE;
+    int max_depth = BENCH_DEFAULT_DEPTH;
+    int threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            max_depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+            if (threads < 1) threads = 1;
+        } else {
+            fprintf(stderr, "Usage: %s [-d <profondeur>] [-f <fichier>] [-t <threads>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (max_depth < 1) max_depth = 1;
+
+    static PositionEntry positions[BENCH_MAX_POSITIONS];
+    int count = position_load_file(path, positions, BENCH_MAX_POSITIONS);
+    if (count <= 0) {
+        fprintf(stderr, "Aucune position lue dans %s\n", path);
+        return 1;
+    }
+
+    if (!tt_is_ready()) tt_init(TT_SIZE_MB);
+    if (threads > 0) ai_set_threads(threads);
+
+    SearchStats total = {0, 0, 0, 0, 0, 0};
+    unsigned long checksum = 0;
+    double total_time = 0;
+
+    for (int p = 0; p < count; p++) {
+        printf("%s\n", positions[p].label);
+        printf("  prof.        nœuds   branch.   coupures   1er coup     temps     cumulé       nœuds/s\n");
+
+        tt_clear();
+        ai_reset_heuristics();
+        unsigned long previous_nodes = 0;
+        double cumulated = 0;
+
+        for (int depth = 1; depth <= max_depth; depth++) {
+            Game game = positions[p].game;
+            SearchStats stats;
+
+            double start = now_s();
+            Move move = (threads > 0) ? minimax_best_move_parallel(&game, depth, &stats)
+                                      : minimax_best_move_stats(&game, depth, &stats);
+            double elapsed = now_s() - start;
+            checksum = checksum_add(checksum, move, stats.score);
+            cumulated += elapsed;
+
+            double branching = previous_nodes ? (double)stats.nodes / previous_nodes : 0;
+            printf("  %5d %12lu %9.2f %9.1f%% %9.1f%% %8.3fs %9.3fs %13.0f\n",
+                   depth, stats.nodes, branching,
+                   percent(stats.cutoffs, stats.expanded), percent(stats.first_cutoffs, stats.cutoffs),
+                   elapsed, cumulated, elapsed > 0 ? stats.nodes / elapsed : 0);
+
+            previous_nodes = stats.nodes;
+            total.nodes += stats.nodes;
+            total.qnodes += stats.qnodes;
+            total.expanded += stats.expanded;
+            total.cutoffs += stats.cutoffs;
+            total.first_cutoffs += stats.first_cutoffs;
+        }
+
+        total_time += cumulated;
+    }
+
+    printf("\n%d positions, profondeurs 1 à %d, %s\n", count, max_depth,
+           threads > 0 ? "recherche répartie" : "recherche mono-thread");
+    if (threads > 0) printf("Threads        : %d\n", ai_get_threads());
+    printf("Nœuds          : %lu (dont %.1f%% en quiescence)\n", total.nodes, percent(total.qnodes, total.nodes));
+    printf("Coupures       : %.1f%% des nœuds, %.1f%% dès le premier coup\n",
+           percent(total.cutoffs, total.expanded), percent(total.first_cutoffs, total.cutoffs));
+    printf("Temps          : %.3f s\n", total_time);
+    printf("Nœuds/s        : %.0f\n", total_time > 0 ? total.nodes / total_time : 0);
+    printf("Signature      : %lu%s\n", total.nodes, threads > 0 ? " (dépend des threads)" : "");
+    printf("Coups          : %016lX\n", checksum);
+
+    tt_free();
+    logger_cleanup();
+    return 0;
+}
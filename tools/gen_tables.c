@@ -0,0 +1,254 @@
+/**
+ * @file gen_tables.c
+ * @brief Générateur des tables précalculées du moteur
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Programme exécuté à la compilation (voir le Makefile) qui écrit sur la
+ * sortie standard un en-tête de tables static const :
+ * - bitboard : rayons par direction, cases voisines par direction (géométrie
+ *   des captures), masques de voisinage et poids de l'évaluation par case
+ *   (carré central et avancée)
+ * - zobrist : clés Zobrist par case et par contenu, et clé du joueur au trait
+ *
+ * Le moteur n'a ainsi aucune table à calculer au démarrage et le compilateur
+ * connaît le contenu de chaque table. Le programme ne dépend que de game.h et
+ * const.h, pas des modules qui incluent les tables générées.
+ *
+ * Utilisation :
+ *   ./gen_tables bitboard > bitboard_tables.h
+ *   ./gen_tables zobrist > zobrist_tables.h
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "game.h"
+#include "const.h"
+
+/** @brief Nombre de cases du plateau */
+#define SQUARES (GRID_SIZE * GRID_SIZE)
+
+/** @brief Graine des clés Zobrist : une position garde la même clé d'une version à l'autre */
+#define ZOBRIST_SEED 0x4B726F6A616E7479ULL
+
+/** @brief Décalage (ligne, colonne) d'un pas, dans l'ordre de l'énumération Direction */
+static const int DIRS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+/**
+ * @brief Bitboard de 81 cases sur deux mots, comme le type Bitboard de bitboard.h
+ */
+typedef struct {
+    uint64_t lo;    /**< Cases 0 à 63 */
+    uint64_t hi;    /**< Cases 64 à 80 */
+} Mask;
+
+/** @brief Ajoute une case à un masque */
+static void mask_set(Mask *mask, int row, int col) {
+    int square = row * GRID_SIZE + col;
+    if (square < 64) mask->lo |= 1ULL << square;
+    else mask->hi |= 1ULL << (square - 64);
+}
+
+/** @brief Indique si des coordonnées sont sur le plateau */
+static int on_board(int row, int col) {
+    return row >= 0 && row < GRID_SIZE && col >= 0 && col < GRID_SIZE;
+}
+
+/** @brief Écrit un masque sous forme d'initialiseur de Bitboard */
+static void print_mask(Mask mask) {
+    printf("{0x%016llXULL, 0x%05llXULL}", (unsigned long long)mask.lo, (unsigned long long)mask.hi);
+}
+
+/**
+ * @brief Générateur pseudo-aléatoire splitmix64
+ *
+ * @param state État du générateur, mis à jour à chaque appel
+ * @return uint64_t Nombre pseudo-aléatoire sur 64 bits
+ */
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Écrit l'en-tête d'un fichier généré
+ *
+ * @param guard Garde d'inclusion
+ * @param brief Description du fichier
+ */
+static void print_prologue(const char *guard, const char *brief) {
+    printf("/**\n");
+    printf(" * @file\n");
+    printf(" * @brief %s\n", brief);
+    printf(" *\n");
+    printf(" * Fichier généré par tools/gen_tables.c : ne pas modifier.\n");
+    printf(" */\n\n");
+    printf("#ifndef %s\n#define %s\n\n", guard, guard);
+}
+
+/**
+ * @brief Écrit les tables de géométrie du plateau et les poids de l'évaluation
+ *
+ * Inclus par bitboard.h après la définition de Bitboard et de BB_SQUARES.
+ */
+static void generate_bitboard(void) {
+    print_prologue("BITBOARD_TABLES_H_INCLUDED", "Tables de géométrie du plateau et poids de l'évaluation par case");
+
+    printf("/** @brief Rayons partant de chaque case, indexés par Direction (haut, bas, gauche, droite) */\n");
+    printf("static const Bitboard BB_RAYS[BB_SQUARES][4] = {\n");
+    for (int square = 0; square < SQUARES; square++) {
+        printf("    {");
+        for (int d = 0; d < 4; d++) {
+            Mask ray = {0, 0};
+            int row = square / GRID_SIZE + DIRS[d][0];
+            int col = square % GRID_SIZE + DIRS[d][1];
+            while (on_board(row, col)) {
+                mask_set(&ray, row, col);
+                row += DIRS[d][0];
+                col += DIRS[d][1];
+            }
+            print_mask(ray);
+            printf(d < 3 ? ", " : "");
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    printf("/** @brief Case voisine dans chaque Direction, -1 hors plateau (la direction opposée à d est d ^ 1) */\n");
+    printf("static const int8_t BB_NEIGHBOUR[BB_SQUARES][4] = {\n");
+    for (int square = 0; square < SQUARES; square++) {
+        printf("    {");
+        for (int d = 0; d < 4; d++) {
+            int row = square / GRID_SIZE + DIRS[d][0];
+            int col = square % GRID_SIZE + DIRS[d][1];
+            printf("%d%s", on_board(row, col) ? row * GRID_SIZE + col : -1, d < 3 ? ", " : "");
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    Mask adjacent[SQUARES];
+    Mask surrounding[SQUARES];
+    for (int square = 0; square < SQUARES; square++) {
+        Mask adj = {0, 0};
+        Mask sur = {0, 0};
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                int row = square / GRID_SIZE + dr;
+                int col = square % GRID_SIZE + dc;
+                if ((dr == 0 && dc == 0) || !on_board(row, col)) continue;
+                mask_set(&sur, row, col);
+                if (dr == 0 || dc == 0) mask_set(&adj, row, col);
+            }
+        }
+        adjacent[square] = adj;
+        surrounding[square] = sur;
+    }
+
+    printf("/** @brief Cases orthogonalement adjacentes à chaque case */\n");
+    printf("static const Bitboard BB_ADJACENT[BB_SQUARES] = {\n");
+    for (int square = 0; square < SQUARES; square++) {
+        printf("    ");
+        print_mask(adjacent[square]);
+        printf(",\n");
+    }
+    printf("};\n\n");
+
+    printf("/** @brief Cases voisines de chaque case, diagonales comprises */\n");
+    printf("static const Bitboard BB_SURROUNDING[BB_SQUARES] = {\n");
+    for (int square = 0; square < SQUARES; square++) {
+        printf("    ");
+        print_mask(surrounding[square]);
+        printf(",\n");
+    }
+    printf("};\n\n");
+
+    printf("/** @brief 1 pour les cases du carré central, 0 ailleurs (terme de util_center) */\n");
+    printf("static const uint8_t EVAL_CENTER[BB_SQUARES] = {\n");
+    for (int row = 0; row < GRID_SIZE; row++) {
+        printf("   ");
+        for (int col = 0; col < GRID_SIZE; col++) {
+            printf(" %d,", row >= 3 && row <= 5 && col >= 3 && col <= 5);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+
+    // P1 avance vers le bas (grandes lignes), P2 vers le haut
+    printf("/** @brief Avancée d'une pièce vers le camp adverse, par camp (0 = P1, 1 = P2) et case (terme de util_forward) */\n");
+    printf("static const uint8_t EVAL_FORWARD[2][BB_SQUARES] = {\n");
+    for (int side = 0; side < 2; side++) {
+        printf("    {\n");
+        for (int row = 0; row < GRID_SIZE; row++) {
+            int weight = 3 * (side == 0 ? row : GRID_SIZE - 1 - row);
+            printf("       ");
+            for (int col = 0; col < GRID_SIZE; col++) printf(" %2d,", weight);
+            printf("\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("#endif // BITBOARD_TABLES_H_INCLUDED\n");
+}
+
+/**
+ * @brief Écrit les clés Zobrist
+ *
+ * Les clés sont tirées d'un générateur splitmix64 à graine fixe, case par
+ * case dans l'ordre de PIECE_KINDS ; la case vide et les octets qui ne sont
+ * pas un contenu de case valent 0. Inclus par zobrist.h.
+ */
+static void generate_zobrist(void) {
+    static uint64_t keys[SQUARES][PIECE_VALUES];
+    uint64_t state = ZOBRIST_SEED;
+
+    memset(keys, 0, sizeof(keys));
+    for (int square = 0; square < SQUARES; square++) {
+        for (int kind = 1; kind < PIECE_KIND_COUNT; kind++) {
+            keys[square][PIECE_KINDS[kind]] = splitmix64(&state);
+        }
+    }
+    uint64_t side = splitmix64(&state);
+
+    print_prologue("ZOBRIST_TABLES_H_INCLUDED", "Clés Zobrist précalculées");
+
+    printf("/** @brief Clés par case (ligne * GRID_SIZE + colonne) et par contenu ; la case vide vaut 0 */\n");
+    printf("static const uint64_t ZOBRIST_PIECES[GRID_SIZE * GRID_SIZE][ZOBRIST_PIECE_KINDS] = {\n");
+    for (int square = 0; square < SQUARES; square++) {
+        printf("    {");
+        for (int piece = 0; piece < PIECE_VALUES; piece++) {
+            printf("0x%016llXULL%s", (unsigned long long)keys[square][piece], piece < PIECE_VALUES - 1 ? ", " : "");
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    printf("/** @brief Clé ajoutée lorsque c'est au joueur 2 de jouer */\n");
+    printf("static const uint64_t ZOBRIST_SIDE = 0x%016llXULL;\n\n", (unsigned long long)side);
+
+    printf("#endif // ZOBRIST_TABLES_H_INCLUDED\n");
+}
+
+/**
+ * @brief Point d'entrée du générateur
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Arguments de la ligne de commande
+ * @return int 0 en cas de succès, 1 en cas d'erreur
+ */
+int main(int argc, char *argv[]) {
+    if (argc == 2 && strcmp(argv[1], "bitboard") == 0) {
+        generate_bitboard();
+    } else if (argc == 2 && strcmp(argv[1], "zobrist") == 0) {
+        generate_zobrist();
+    } else {
+        fprintf(stderr, "Usage: %s bitboard|zobrist\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
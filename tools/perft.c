@@ -0,0 +1,196 @@
+/**
+ * @file perft.c
+ * @brief Outil de comptage des feuilles (perft) du générateur de coups
+ * @author Équipe IMM2526-GR4
+ * @date 17 septembre 2025
+ *
+ * Programme sans interface graphique qui compte les positions atteintes
+ * à chaque profondeur, depuis STARTING_BOARD ou des positions fournies, et
+ * affiche le débit en nœuds par seconde du générateur de la recherche.
+ *
+ * Le mode divide détaille le compte par coup racine et le compare à celui du
+ * générateur mailbox de référence (all_possible_moves) : toute optimisation du
+ * plateau doit laisser les comptes identiques. Le programme se termine avec le
+ * code 1 en cas de différence.
+ *
+ * Utilisation :
+ *   ./perft [-d <profondeur>] [-p "<position>"] [-f <fichier>] [-divide]
+ *
+ * Le format des positions est décrit dans position.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "game.h"
+#include "algo.h"
+#include "bitboard.h"
+#include "position.h"
+#include "logging.h"
+
+/** @brief Nombre maximal de positions lues dans un fichier */
+#define PERFT_MAX_POSITIONS 256
+
+/** @brief Profondeur par défaut */
+#define PERFT_DEFAULT_DEPTH 4
+
+/**
+ * @brief Temps écoulé sur l'horloge monotone
+ *
+ * @return double Temps courant en secondes
+ */
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Affiche les comptes de chaque profondeur et le débit du générateur
+ *
+ * @param game Position de départ
+ * @param max_depth Profondeur maximale
+ * @return void
+ */
+static void run_perft(Game *game, int max_depth) {
+    for (int depth = 1; depth <= max_depth; depth++) {
+        double start = now_s();
+        unsigned long long nodes = perft(game, depth);
+        double elapsed = now_s() - start;
+        double nps = (elapsed > 0) ? nodes / elapsed : 0;
+
+        printf("  profondeur %2d : %14llu nœuds  %9.3f s  %12.0f nœuds/s\n", depth, nodes, elapsed, nps);
+    }
+}
+
+/**
+ * @brief Compare coup par coup le générateur de la recherche à la référence
+ *
+ * @param game Position de départ
+ * @param depth Profondeur totale (coup racine compris)
+ * @return int Nombre de différences constatées
+ */
+static int run_divide(Game *game, int depth) {
+    Move reference[10 * 16];
+    PackedMove generated[10 * 16];
+    BitboardPosition pos;
+    Player player = current_player_turn(game);
+    int errors = 0;
+
+    // Coups racine : les deux générateurs doivent produire la même liste
+    bitboard_from_game(&pos, game);
+    int size = all_possible_moves(game, reference, player);
+    int size_generated = bitboard_generate_moves(&pos, player, generated);
+    int same = (size == size_generated);
+    for (int i = 0; same && i < size; i++) same = (move_pack(reference[i]) == generated[i]);
+    if (!same) {
+        printf("  ERREUR : coups racine différents (%d référence, %d bitboard)\n", size, size_generated);
+        errors++;
+    }
+
+    unsigned long long total = 0;
+    unsigned long long total_reference = 0;
+    double time_fast = 0;
+    double time_reference = 0;
+
+    for (int i = 0; i < size; i++) {
+        Game child = *game;
+        update_with_move(&child, reference[i]);
+
+        double start = now_s();
+        unsigned long long nodes = perft(&child, depth - 1);
+        time_fast += now_s() - start;
+
+        start = now_s();
+        unsigned long long nodes_reference = perft_reference(&child, depth - 1);
+        time_reference += now_s() - start;
+
+        char notation[5];
+        move_to_notation(reference[i], notation);
+        printf("  %s : %12llu", notation, nodes);
+        if (nodes != nodes_reference) {
+            printf("  ERREUR : référence %llu", nodes_reference);
+            errors++;
+        }
+        printf("\n");
+
+        total += nodes;
+        total_reference += nodes_reference;
+    }
+
+    printf("  total : %llu nœuds (référence %llu)\n", total, total_reference);
+    printf("  recherche : %.3f s, %.0f nœuds/s\n", time_fast, time_fast > 0 ? total / time_fast : 0);
+    printf("  référence : %.3f s, %.0f nœuds/s\n", time_reference, time_reference > 0 ? total_reference / time_reference : 0);
+    return errors;
+}
+
+/**
+ * @brief Point d'entrée de l'outil perft
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Arguments de la ligne de commande
+ * @return int 0 si tous les comptes concordent, 1 sinon
+ */
+int main(int argc, char *argv[]) {
+    if (logger_init("./logs/perft.log", LOG_INFO) != 0) {
+        fprintf(stderr, "Impossible d'initialiser le logger\n");
+        return 1;
+    }
+
+    static PositionEntry positions[PERFT_MAX_POSITIONS];
+    int count = 0;
+    int depth = PERFT_DEFAULT_DEPTH;
+    int divide = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-divide") == 0) {
+            divide = 1;
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc && count < PERFT_MAX_POSITIONS) {
+            if (position_parse(&positions[count].game, argv[++i]) < 0) {
+                fprintf(stderr, "Position invalide : %s\n", argv[i]);
+                return 1;
+            }
+            snprintf(positions[count].label, POSITION_LABEL_LEN, "ligne de commande");
+            count++;
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            int loaded = position_load_file(argv[++i], positions + count, PERFT_MAX_POSITIONS - count);
+            if (loaded < 0) {
+                fprintf(stderr, "Impossible de lire %s\n", argv[i]);
+                return 1;
+            }
+            count += loaded;
+        } else {
+            fprintf(stderr, "Usage: %s [-d <profondeur>] [-p \"<position>\"] [-f <fichier>] [-divide]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (depth < 1) depth = 1;
+
+    // Sans position fournie : plateau de départ
+    if (count == 0) {
+        positions[0].game = init_game(LOCAL, 0);
+        snprintf(positions[0].label, POSITION_LABEL_LEN, "départ");
+        count = 1;
+    }
+
+    int errors = 0;
+    for (int i = 0; i < count; i++) {
+        char text[POSITION_MAX_LEN];
+        position_format(&positions[i].game, text, sizeof(text));
+        printf("%s (%s)\n", text, positions[i].label);
+
+        if (divide) errors += run_divide(&positions[i].game, depth);
+        else run_perft(&positions[i].game, depth);
+    }
+
+    if (divide) printf("%s\n", errors ? "ÉCHEC : comptes différents" : "OK : comptes identiques");
+
+    logger_cleanup();
+    return errors ? 1 : 0;
+}